@@ -0,0 +1,167 @@
+/**
+ * @file    HestiaTempoBench.cpp
+ * @brief   Host benchmark for the HestiaTempo engine.
+ *
+ * @details
+ * Built by the PlatformIO `native` environment (`pio run -e native`, then
+ * run `.pio/build/native/program`). The engine runs on the virtual clock,
+ * so results only reflect CPU cost. Compare numbers from the same machine
+ * before and after an engine change.
+ *
+ * Measured:
+ *  - Slot lookup with 8 / 32 / 128 live timers
+ *  - every() / done() throughput (facade and cached handle)
+ *  - Checking 16 timeouts: 16 facade calls vs. one Group::expired()
+ *  - Timing wheel with 400 pending timeouts: start / cancel and poll()
+ *  - Duration parsing and formatting cost per call
+ *
+ * With HESTIA_TEMPO_MINIMAL the string-duration, parsing and formatting
+ * benchmarks are left out, as their APIs are compiled out.
+ */
+
+#include "HestiaTempo.h"
+#if !defined(HESTIA_TEMPO_MINIMAL)
+#include "HestiaTempoFormat.h"
+#endif
+
+#include <chrono>
+#include <stdio.h>
+
+namespace {
+
+  volatile uint32_t g_sink = 0;   ///< Defeats dead-code elimination
+
+  /**
+   * @brief Run `fn` `iterations` times and print its cost per call.
+   */
+  template <typename F>
+  void bench(const char* name, uint32_t iterations, F fn) {
+    using namespace std::chrono;
+
+    for (uint32_t i = 0; i < iterations / 10; ++i) fn(i);   // warm-up
+
+    const auto t0 = steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) fn(i);
+    const auto t1 = steady_clock::now();
+
+    const double ns = (double)duration_cast<nanoseconds>(t1 - t0).count() / iterations;
+    printf("%-36s %10.2f ns/op\n", name, ns);
+  }
+
+  /**
+   * @brief Lookup cost in a pool holding N live timers.
+   */
+  template <size_t N>
+  void benchLookup(const char* name) {
+    static Tempo::Pool<N> pool;
+    Tempo::Id ids[N];
+
+    for (size_t i = 0; i < N; ++i) {
+      ids[i] = 0xB0000000u + (Tempo::Id)i * 7u;
+      pool.interval(ids[i]).every(1000);
+    }
+
+    bench(name, 2000000, [&](uint32_t i) {
+      g_sink = g_sink + (pool.slot(ids[i % N], Tempo::Kind::Interval, false) != nullptr);
+    });
+  }
+
+} // namespace
+
+// `pio test` builds the sources with PIO_UNIT_TESTING; the test runner
+// provides main() then
+#if !defined(PIO_UNIT_TESTING)
+int main() {
+  using namespace Tempo;
+
+  printf("HestiaTempo benchmark (ticks per ms: %u)\n\n", (unsigned)TICKS_PER_MS);
+
+  // Lookup
+  benchLookup<8>("lookup, 8 timers");
+  benchLookup<32>("lookup, 32 timers");
+  benchLookup<128>("lookup, 128 timers");
+
+  // Hot-path queries (clock advances 1 ms every 16 calls)
+  bench("Interval::every() (facade)", 2000000, [](uint32_t i) {
+    if ((i & 15) == 0) VirtualClock::advanceMs(1);
+    g_sink = g_sink + Tempo::interval("BENCH_EVERY"_id).every(100);
+  });
+
+  IntervalHandle every("BENCH_HANDLE"_id);
+  bench("IntervalHandle::every()", 2000000, [&](uint32_t i) {
+    if ((i & 15) == 0) VirtualClock::advanceMs(1);
+    g_sink = g_sink + every.every(100);
+  });
+
+  Tempo::oneShot("BENCH_DONE"_id).start(1000000);
+  bench("OneShot::done() (pending)", 2000000, [](uint32_t) {
+    g_sink = g_sink + Tempo::oneShot("BENCH_DONE"_id).done();
+  });
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  bench("Interval::every(\"00:00:01\")", 2000000, [](uint32_t) {
+    g_sink = g_sink + Tempo::interval("BENCH_STR"_id).every("00:00:01");
+  });
+#endif
+
+  // 16 channel timeouts checked per loop
+  for (Id ch = 0; ch < 16; ++ch) Tempo::oneShot(0xC0000000u + ch).start(1000000);
+  bench("16x OneShot::done() (facade)", 200000, [](uint32_t) {
+    uint32_t due = 0;
+    for (Id ch = 0; ch < 16; ++ch) due |= (uint32_t)Tempo::oneShot(0xC0000000u + ch).done() << ch;
+    g_sink = g_sink + due;
+  });
+
+  static Group<16> channels;
+  for (size_t ch = 0; ch < 16; ++ch) channels.start(ch, 1000000);
+  bench("Group<16>::expired()", 200000, [](uint32_t) {
+    g_sink = g_sink + channels.expired();
+  });
+
+  // Timing wheel: 400 pending ack timeouts, one replaced per call
+  static Wheel<512> acks;
+  for (Id m = 0; m < 400; ++m) acks.start(0xD0000000u + m, 1000 + m * 7);
+  bench("Wheel<512>::cancel() + start()", 2000000, [](uint32_t i) {
+    const Id m = 0xD0000000u + i % 400;
+    acks.cancel(m);
+    g_sink = g_sink + acks.start(m, 1000 + (i & 1023));
+  });
+  bench("Wheel<512>::poll() (1 ms per call)", 200000, [](uint32_t i) {
+    VirtualClock::advanceMs(1);
+    g_sink = g_sink + (uint32_t)acks.poll([](Id id, void*) { acks.start(id, 1500); });
+    (void)i;
+  });
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  // Parsing (the pointer is laundered so nothing folds at compile time)
+  const char* volatile hms   = "12:34:56";
+  const char* volatile unit = "1.5s";
+  bench("parseHMS(\"12:34:56\")", 2000000, [&](uint32_t) {
+    uint32_t ms = 0;
+    HestiaTempoFormat::parseHMS(hms, ms);
+    g_sink = g_sink + ms;
+  });
+  bench("parseDuration(\"1.5s\")", 2000000, [&](uint32_t) {
+    uint32_t ms = 0;
+    detail::parseDuration(unit, (size_t)-1, ms);
+    g_sink = g_sink + ms;
+  });
+
+  // Formatting
+  static const struct { const char* name; Format fmt; } formats[] = {
+    { "format(HMS_MS)",     Format::HMS_MS },
+    { "format(HMS)",        Format::HMS },
+    { "format(MS)",         Format::MS },
+    { "format(AUTO_SHORT)", Format::AUTO_SHORT },
+  };
+  for (const auto& f : formats) {
+    bench(f.name, 2000000, [&](uint32_t i) {
+      char buf[FORMAT_BUFFER_SIZE];
+      g_sink = g_sink + (uint32_t)HestiaTempoFormat::format(i * 37u, buf, sizeof(buf), f.fmt);
+    });
+  }
+#endif // !HESTIA_TEMPO_MINIMAL
+
+  return 0;
+}
+#endif // !PIO_UNIT_TESTING
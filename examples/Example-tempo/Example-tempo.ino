@@ -65,11 +65,12 @@ void loop() {
 
   if (Tempo::interval("HEARTBEAT"_id).every(1000)) {
 
-    Serial.println(Tempo::oneShot("test"_id).remaining());
-    Serial.println(Tempo::remainingStr("test"_id, Tempo::Format::AUTO_SHORT));
-    Serial.println(Tempo::remainingStr("test"_id, Tempo::Format::HMS_MS));
-    Serial.println(Tempo::remainingStr("test"_id, Tempo::Format::HMS));
-    Serial.println(Tempo::remainingStr("test"_id, Tempo::Format::MS));
+    // One write to Serial for the whole line
+    Tempo::PrintBatch(Serial)
+      .remaining("test"_id, Tempo::Format::AUTO_SHORT).text(" | ")
+      .remaining("test"_id, Tempo::Format::HMS_MS).text(" | ")
+      .remaining("test"_id, Tempo::Format::HMS).text(" | ")
+      .remaining("test"_id, Tempo::Format::MS).text("\r\n");
 
   }
 
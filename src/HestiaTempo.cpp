@@ -1,6 +1,23 @@
 #include "HestiaTempo.h"
+#if !defined(HESTIA_TEMPO_MINIMAL)
 #include "HestiaTempoFormat.h"
+#endif
+
+#if defined(ARDUINO)
 #include <Arduino.h>
+#endif
+
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER) && !defined(ARDUINO_ARCH_ESP32)
+#error "HESTIA_TEMPO_BACKEND_ESP_TIMER requires an ESP32 target"
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <esp_timer.h>
+#endif
+
+#if defined(HESTIA_TEMPO_THREAD_SAFE) && defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#endif
 
 /**
  * @file    HestiaTempo.cpp
@@ -11,15 +28,18 @@
  * Interval and OneShot facades defined in HestiaTempo.h.
  *
  * Design characteristics:
- *  - Centralized slot table (static, fixed size)
+ *  - Slot pools (static, fixed size, independently sized)
+ *  - Hashed slot lookup per pool (open addressing, O(1) on average)
  *  - No dynamic allocation
  *  - No heap usage
  *  - No String usage
- *  - All time measurements based on millis()
+ *  - All time measurements based on millis() (optionally latched per frame),
+ *    or on a 64-bit microsecond clock with HESTIA_TEMPO_TIMEBASE_US
  *
  * The engine is intentionally hidden behind lightweight facade objects
  * (Interval / OneShot). These objects are stateless wrappers that reference
- * internal slots via a symbolic Tempo::Id.
+ * internal slots via a symbolic Tempo::Id. Cached handles (IntervalHandle /
+ * OneShotHandle) resolve their slot once and reference it directly.
  *
  * The engine guarantees:
  *  - Deterministic behavior
@@ -29,227 +49,1719 @@
  * The engine does NOT:
  *  - Track wall-clock time
  *  - Perform formatting or parsing of time values
- *  - Provide thread-safety or ISR-safety
+ *  - Provide thread-safety (unless HESTIA_TEMPO_THREAD_SAFE is defined)
+ *  - Provide ISR-safety
  */
 
 namespace Tempo {
 
   // ============================================================================
-  // Internal types
+  // Internal state
+  // ============================================================================
+  //
+  // Kind and Slot are declared in HestiaTempo.h so that statically allocated
+  // storage (e.g. Registry) can embed slots directly.
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  /**
+  * @brief Last recorded Tempo error.
+  *
+  * @note
+  * This variable is intentionally file-local.
+  */
+  static Error g_lastError = Error::None;
+#endif
+
+  /**
+   * @brief Record an error (compiled out by HESTIA_TEMPO_MINIMAL).
+   */
+  static inline void setError(Error e) {
+#if defined(HESTIA_TEMPO_MINIMAL)
+    (void)e;
+#else
+    g_lastError = e;
+#endif
+  }
+
+  // ============================================================================
+  // Synchronization (HESTIA_TEMPO_THREAD_SAFE)
   // ============================================================================
+  //
+  // Without HESTIA_TEMPO_THREAD_SAFE every primitive below compiles to a
+  // plain access or to nothing.
+  //
+  // With it:
+  //  - Index cells are published with release/acquire ordering, so a
+  //    lock-free probe that finds a cell also sees the slot it points to
+  //  - Structural changes (allocation, release, pool list) hold TableLock;
+  //    a lookup only takes it to insert a missing Id
+  //  - Each pool's deadline cache holds that pool's DueLock
+  //  - Slot timestamps follow a seqlock protocol: a writer (SlotWriter)
+  //    owns the slot by moving its sequence counter from even to odd, so
+  //    writers of different slots never contend; readers (readTime) retry
+  //    instead of locking
+  //
+  // Lock order: TableLock, then DueLock or SlotWriter. Nothing else is
+  // acquired while a SlotWriter is held.
+
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+  template <typename T>
+  static inline T loadAcquire(const T& v) { return __atomic_load_n(&v, __ATOMIC_ACQUIRE); }
+
+  template <typename T>
+  static inline void storeRelease(T& v, T x) { __atomic_store_n(&v, x, __ATOMIC_RELEASE); }
+
+#if defined(ARDUINO_ARCH_ESP32)
+  /**
+   * @brief Cross-core spinlock (interrupts masked on the owning core).
+   */
+  class SpinLock {
+  public:
+    void lock()   { portENTER_CRITICAL(&_mux); }
+    void unlock() { portEXIT_CRITICAL(&_mux); }
+  private:
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+  };
+#else
+  class SpinLock {
+  public:
+    void lock()   { while (__atomic_test_and_set(&_flag, __ATOMIC_ACQUIRE)) {} }
+    void unlock() { __atomic_clear(&_flag, __ATOMIC_RELEASE); }
+  private:
+    bool _flag = false;
+  };
+#endif
+
+  static SpinLock g_tableLock;
+
+  class TableLock {
+  public:
+    TableLock()  { g_tableLock.lock(); }
+    ~TableLock() { g_tableLock.unlock(); }
+  };
 
+#if defined(ARDUINO_ARCH_ESP32)
   /**
-   * @brief Internal timer kind.
+   * @brief Interrupts masked on the current core for the scope's duration.
    *
-   * @note
-   * A slot is permanently associated with its kind (Interval or OneShot)
-   * once allocated.
+   * @details
+   * Held with the per-pool and per-slot locks below, so that their owner
+   * is never preempted on its core: a task spinning on one of them always
+   * sees it released promptly.
+   */
+  class IrqGuard {
+  public:
+    IrqGuard()  : _state(portSET_INTERRUPT_MASK_FROM_ISR()) {}
+    ~IrqGuard() { portCLEAR_INTERRUPT_MASK_FROM_ISR(_state); }
+  private:
+    UBaseType_t _state;
+  };
+#else
+  struct IrqGuard { IrqGuard() {} };
+#endif
+
+  /**
+   * @brief Lock on a pool's deadline cache (the pool's own lock word).
    */
-  enum class Kind : uint8_t {
-    None,
-    Interval,
-    OneShot
+  class DueLock {
+  public:
+    explicit DueLock(SlotPool& pool) : _word(pool._dueLock) {
+      uint32_t free = 0;
+      while (!__atomic_compare_exchange_n(&_word, &free, 1u, true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        free = 0;
+      }
+    }
+    ~DueLock() { __atomic_store_n(&_word, 0u, __ATOMIC_RELEASE); }
+  private:
+    IrqGuard  _irq;   // masked before the word is taken, restored after
+    uint32_t& _word;
   };
 
   /**
-   * @brief Internal timer slot.
+   * @brief Writer section on a slot's timing fields.
    *
    * @details
-   * Each slot represents one logical timer identified by a Tempo::Id.
-   * Slots are allocated lazily on first use and never freed.
-   */
-  struct Slot {
-    Id       id      = 0;
-    Kind     kind    = Kind::None;
-    uint32_t start   = 0;   ///< Start timestamp (millis)
-    uint32_t period  = 0;   ///< Duration or interval (ms)
-    bool     active  = false;
+   * The writer owns the slot while its sequence counter is odd: entering
+   * moves it from even to odd with a CAS, leaving makes it even again.
+   * Writes are short (a few stores) and, on ESP32, run with interrupts
+   * masked, so a reader or writer spinning on an odd counter always sees
+   * the owner finish promptly.
+   */
+  class SlotWriter {
+  public:
+    explicit SlotWriter(Slot* s) : _s(s) {
+      uint32_t v;
+      do {
+        v = __atomic_load_n(&s->seq, __ATOMIC_RELAXED) & ~1u;   // fails while odd
+      } while (!__atomic_compare_exchange_n(&s->seq, &v, v + 1, true,
+                                            __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+      __atomic_thread_fence(__ATOMIC_RELEASE);
+    }
+    ~SlotWriter() {
+      __atomic_store_n(&_s->seq, _s->seq + 1, __ATOMIC_RELEASE);
+    }
+  private:
+    IrqGuard _irq;
+    Slot*    _s;
   };
 
+#define HESTIA_TEMPO_TLS thread_local
+#else
+  template <typename T>
+  static inline T loadAcquire(const T& v) { return v; }
+
+  template <typename T>
+  static inline void storeRelease(T& v, T x) { v = x; }
+
+  struct TableLock  { TableLock() {} };
+  class  DueLock    { public: explicit DueLock(SlotPool&) {} };
+  struct SlotWriter { explicit SlotWriter(Slot*) {} };
+
+#define HESTIA_TEMPO_TLS
+#endif
+
   /**
-  * @brief Last recorded Tempo error.
-  *
-  * @note
-  * This variable is intentionally file-local.
-  */
-  static Error g_lastError = Error::None;
+   * @brief Consistent snapshot of a slot's timing fields.
+   */
+  struct SlotTime {
+    Tick start;
+    union {              // as in Slot, keyed on kind
+      Tick period;
+      Tick tokens;
+    };
+    bool active;
+    bool release;
+  };
+
+  static inline SlotTime readTime(const Slot* s) {
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    for (;;) {
+      const uint32_t v = __atomic_load_n(&s->seq, __ATOMIC_ACQUIRE);
+      if (v & 1u) continue;
+      const SlotTime t = { s->start, s->period, s->active, s->release };
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      if (__atomic_load_n(&s->seq, __ATOMIC_RELAXED) == v) return t;
+    }
+#else
+    return SlotTime{ s->start, s->period, s->active, s->release };
+#endif
+  }
+
+  /**
+   * @brief Snapshot of a slot's timing fields, for use inside a SlotWriter.
+   */
+  static inline SlotTime readTimeUnlocked(const Slot* s) {
+    return SlotTime{ s->start, s->period, s->active, s->release };
+  }
+
+  /**
+   * @brief Reset a slot and its cold data to their default state (keeps
+   *        the sequence counter and, with the esp_timer backend, the
+   *        hardware timer).
+   */
+  static inline void resetSlot(Slot* s, SlotExtra* x) {
+    // Field by field: the sequence counter stays odd (owned by `w`) for
+    // the whole reset
+    SlotWriter w(s);
+    s->start    = 0;
+    s->period   = 0;
+    s->id       = 0;
+    s->overruns = 0;
+    s->kind     = Kind::None;
+    s->active   = false;
+    s->release  = false;
+    s->consumed = false;
+    s->catchUp  = (uint8_t)CatchUp::Burst;
+    if (x) *x = SlotExtra{};
+#if defined(HESTIA_TEMPO_STATS)
+    s->stats    = Stats{};
+#endif
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+    s->extra    = x;
+    s->fired    = 0;
+    s->direct   = false;
+    s->rephase  = false;
+#endif
+  }
+
+  // ============================================================================
+  // Expiry source
+  // ============================================================================
+  //
+  // By default expiry is derived from the clock. With the esp_timer backend,
+  // a slot whose hardware timer could be created is flagged by the timer
+  // instead; slots without one (creation failed) fall back to the clock.
+
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+  /**
+   * @brief esp_timer callback (runs in the esp_timer task).
+   */
+  static void hwExpired(void* arg) {
+    Slot* s = static_cast<Slot*>(arg);
+
+    if (s->rephase) {
+      // Shortened first period done: continue on the regular period
+      s->rephase = false;
+      const uint64_t us = (uint64_t)s->period * (1000 / TICKS_PER_MS);
+      esp_timer_start_periodic(static_cast<esp_timer_handle_t>(s->timer), us > 0 ? us : 1);
+    }
+
+    const SlotExtra* x = s->extra;
+    if (s->direct && x && x->handler) {
+      {
+        SlotWriter w(s);
+        if (!s->active) return;
+        if (s->kind == Kind::Interval) {
+          s->start += s->period;
+        } else {
+          s->active   = false;
+          s->consumed = true;
+        }
+      }
+      x->handler(s->id, x->ctx);
+      return;
+    }
+
+    __atomic_add_fetch(&s->fired, 1, __ATOMIC_RELEASE);
+  }
+
+  /**
+   * @brief (Re)arm the slot's hardware timer for its current period.
+   *
+   * @param first  Delay before the first expiry of a periodic timer
+   *               (0: one full period).
+   */
+  static void hwArm(Slot* s, bool periodic, Tick first = 0) {
+    if (!s->timer) {
+      esp_timer_create_args_t args = {};
+      args.callback = &hwExpired;
+      args.arg      = s;
+      args.name     = "tempo";
+      esp_timer_handle_t h = nullptr;
+      if (esp_timer_create(&args, &h) != ESP_OK) return;   // clock fallback
+      s->timer = h;
+    }
+
+    esp_timer_handle_t h = static_cast<esp_timer_handle_t>(s->timer);
+    esp_timer_stop(h);
+    __atomic_store_n(&s->fired, 0, __ATOMIC_RELAXED);
+
+    const uint64_t us = (uint64_t)s->period * (1000 / TICKS_PER_MS);
+    s->rephase = periodic && first > 0 && first != s->period;
+    if (s->rephase)    esp_timer_start_once(h, (uint64_t)first * (1000 / TICKS_PER_MS));
+    else if (periodic) esp_timer_start_periodic(h, us > 0 ? us : 1);
+    else               esp_timer_start_once(h, us);
+  }
+
+  static inline void hwStop(Slot* s) {
+    if (s->timer) esp_timer_stop(static_cast<esp_timer_handle_t>(s->timer));
+  }
+
+  /**
+   * @brief Consume one signalled Interval expiry.
+   */
+  static inline void hwConsume(Slot* s) {
+    if (s->timer) __atomic_sub_fetch(&s->fired, 1, __ATOMIC_RELAXED);
+  }
+
+  /**
+   * @brief Consume every signalled Interval expiry.
+   */
+  static inline void hwConsumeAll(Slot* s) {
+    if (s->timer) __atomic_store_n(&s->fired, 0, __ATOMIC_RELAXED);
+  }
+
+  static inline bool slotExpired(const Slot* s, const SlotTime& t, Tick now) {
+    if (s->timer) return __atomic_load_n(&s->fired, __ATOMIC_ACQUIRE) != 0;
+    return (Tick)(now - t.start) >= t.period;
+  }
+#else
+  static inline void hwArm(Slot*, bool, Tick = 0) {}
+  static inline void hwStop(Slot*) {}
+  static inline void hwConsume(Slot*) {}
+  static inline void hwConsumeAll(Slot*) {}
+
+  static inline bool slotExpired(const Slot*, const SlotTime& t, Tick now) {
+    return (Tick)(now - t.start) >= t.period;
+  }
+#endif
+
+  // ============================================================================
+  // Time source
+  // ============================================================================
+
+  /**
+   * @brief Frame mode state (see Tempo::beginFrame()).
+   */
+  static HESTIA_TEMPO_TLS bool g_frameActive = false;
+  static HESTIA_TEMPO_TLS Tick g_frameNow    = 0;
+
+  static Tick g_virtualNow = 0;
+
+  Tick VirtualClock::now()          { return loadAcquire(g_virtualNow); }
+  void VirtualClock::set(Tick t)    { storeRelease(g_virtualNow, t); }
+  void VirtualClock::advance(Tick dt) {
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    __atomic_add_fetch(&g_virtualNow, dt, __ATOMIC_RELEASE);
+#else
+    g_virtualNow += dt;
+#endif
+  }
+
+  Tick clocks::Virtual::now() {
+    return loadAcquire(g_virtualNow);
+  }
+
+#if defined(ARDUINO)
+  Tick clocks::Millis::now() {
+    return (Tick)millis() * TICKS_PER_MS;
+  }
+
+  /**
+   * @details
+   * micros() is extended to 64 bits by counting its wrap-arounds, which
+   * requires the clock to be read at least once every ~71 minutes.
+   */
+  Tick clocks::Micros::now() {
+    static uint32_t last = 0;
+    static uint32_t high = 0;
+    const uint32_t low = micros();
+    if (low < last) ++high;
+    last = low;
+    return (Tick)((((uint64_t)high << 32) | low) / (1000 / TICKS_PER_MS));
+  }
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+  Tick clocks::EspTimer::now() {
+    return (Tick)((uint64_t)esp_timer_get_time() / (1000 / TICKS_PER_MS));
+  }
+#endif
+
+  /**
+   * @brief Raw engine clock: the selected policy, optionally accelerated.
+   *
+   * @details
+   * Scaling is applied in modular tick arithmetic, so elapsed-time
+   * comparisons stay correct across wrap-around. A simulated clock is
+   * already as fast as its driver and is never scaled: idle() advances it
+   * by exactly the engine time it waits for.
+   */
+  static inline Tick clockRaw() {
+    if (Clock::simulated) return Clock::now();
+    return (Tick)(Clock::now() * (Tick)HESTIA_TEMPO_CLOCK_SCALE);
+  }
+
+  /**
+   * @brief Engine time: the latched frame timestamp, or the raw clock.
+   */
+  static inline Tick clockNow() {
+    return g_frameActive ? g_frameNow : clockRaw();
+  }
+
+  // ============================================================================
+  // Tick conversions
+  // ============================================================================
+  //
+  // With the default millisecond time base these fold to no-ops.
+
+  static inline Tick msToTicks(uint32_t ms) {
+    return (Tick)ms * TICKS_PER_MS;
+  }
+
+  /**
+   * @brief Ticks to milliseconds, rounded down, saturated to 32 bits.
+   */
+  static inline uint32_t ticksToMs(Tick t) {
+    const Tick ms = t / TICKS_PER_MS;
+    return (ms > (Tick)0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)ms;
+  }
+
+  /**
+   * @brief Ticks to milliseconds, rounded up (remaining time reaches 0
+   *        only once the deadline has actually passed).
+   */
+  static inline uint32_t ticksToMsCeil(Tick t) {
+    return ticksToMs(t + (TICKS_PER_MS - 1));
+  }
+
+  Tick beginFrame() {
+    g_frameNow    = clockRaw();
+    g_frameActive = true;
+    return g_frameNow;
+  }
+
+  void endFrame() {
+    g_frameActive = false;
+  }
 
 
   // ============================================================================
-  // Slot storage
+  // Slot pools
   // ============================================================================
 
   /**
-   * @brief Maximum number of concurrent timers.
+   * @brief Default slot pool.
    *
    * @note
-   * This value bounds memory usage deterministically.
+   * Constant-initialized: usable from static constructors in other units.
+   */
+  static Pool<HESTIA_TEMPO_MAX_SLOTS> g_defaultPool;
+
+  /**
+   * @brief Pools that have allocated at least one slot (intrusive list).
+   *
+   * @details
+   * Pools link themselves on first allocation, so no static constructor
+   * ordering is involved.
    */
-  static constexpr size_t MAX_SLOTS = 32;
+  static SlotPool* g_pools = nullptr;
+
+  void SlotPool::link() {
+    // Called with TableLock held; lock-free readers walk the list
+    _next = g_pools;
+    storeRelease(g_pools, this);
+    _linked = true;
+  }
+
+  SlotPool::~SlotPool() {
+    if (!_linked) return;
+    TableLock lock;
+    for (SlotPool** p = &g_pools; *p; p = &(*p)->_next) {
+      if (*p == this) {
+        *p = _next;
+        break;
+      }
+    }
+  }
+
+  SlotPool& defaultPool() {
+    return g_defaultPool;
+  }
 
   /**
-   * @brief Static slot table.
+   * @brief Home cell of an Id in a pool index.
+   *
+   * @details
+   * Fibonacci hashing spreads the FNV-1a bits over the index, including
+   * for runtime-derived Ids that only differ in their low bits.
    */
-  static Slot slots[MAX_SLOTS];
+  static inline size_t indexHome(Id id, uint8_t bits) {
+    return (uint32_t)(id * 0x9E3779B1u) >> (32 - bits);
+  }
 
   /**
    * @brief Retrieve or allocate a slot for a given Id and Kind.
    *
    * @param id Timer identifier.
    * @param expected Expected timer kind.
-   * @return Pointer to slot or nullptr if table is full.
+   * @param create Allocate a slot if the Id is unknown.
+   * @return Pointer to slot, or nullptr if the pool is full (or the Id is
+   *         unknown and create is false).
+   *
+   * @details
+   * Lookup cost is O(1) on average: the probe starts at the Id's home cell
+   * and stops at the first matching or empty cell. A miss reuses the empty
+   * cell it stopped on, so allocation does not need a second pass.
    *
    * @warning
    * If an existing slot with the same Id but a different Kind exists,
    * behavior is undefined. Users must not reuse the same Id for different
    * timer kinds.
    */
-  static Slot* getSlot(Id id, Kind expected) {
-    // Lookup existing slot
-    for (auto& s : slots) {
-      if (s.id == id) {
-          if (s.kind != expected) {
-            g_lastError = Error::IdKindMismatch;
-          }
+  Slot* SlotPool::probe(Id id, Kind expected, size_t& cell) {
+    const size_t mask = (size_t(1) << _indexBits) - 1;
+    cell = indexHome(id, _indexBits);
+
+    // Only the dense Id array is scanned; the slot is touched on a match
+    for (uint16_t e; (e = loadAcquire(_cells[cell])) != 0; cell = (cell + 1) & mask) {
+      if (_ids[e - 1] == id) {
+        Slot& s = _slots[e - 1];
+        if (s.kind != expected) {
+          setError(Error::IdKindMismatch);
+        }
         return &s;
       }
     }
+    return nullptr;
+  }
 
-    // Allocate new slot
-    for (auto& s : slots) {
-      if (s.kind == Kind::None) {
-        s.id   = id;
-        s.kind = expected;
-        return &s;
-      }
+  Slot* SlotPool::slot(Id id, Kind expected, bool create) {
+    size_t cell;
+
+    // Lookup existing slot (lock-free)
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    // A backward shift in progress may hide an entry from the probe: a miss
+    // only counts if no release overlapped it
+    for (;;) {
+      const uint32_t v = loadAcquire(_shiftSeq);
+      if (Slot* s = probe(id, expected, cell)) return s;
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      if (!(v & 1u) && __atomic_load_n(&_shiftSeq, __ATOMIC_RELAXED) == v) break;
     }
+#else
+    if (Slot* s = probe(id, expected, cell)) return s;
+#endif
+    if (!create) return nullptr;
 
-    g_lastError = Error::SlotTableFull;
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    // About to insert: the miss may race with a claim or a backward shift,
+    // confirm it under lock
+    TableLock lock;
+    if (Slot* s = probe(id, expected, cell)) return s;
+#endif
+
+    if (!_linked) link();
 
     // No free slot
-    return nullptr;
+    if (_count >= _capacity) {
+      setError(Error::SlotTableFull);
+      return nullptr;
+    }
+
+    // Allocate new slot: recycle a released one first, O(1)
+    uint16_t pos;
+    if (_freeHead != 0) {
+      pos       = _freeHead - 1;
+      _freeHead = (uint16_t)_slots[pos].start;
+    } else {
+      pos = _fresh++;
+    }
+
+    Slot& s = _slots[pos];
+    resetSlot(&s, extra(&s));
+    {
+      SlotWriter w(&s);   // a stale handle may still write the flags
+      s.id   = id;
+      s.kind = expected;
+    }
+    _ids[pos] = id;
+    storeRelease(_cells[cell], (uint16_t)(pos + 1));   // publish
+    ++_count;
+    return &s;
   }
 
-  // ============================================================================
-  // Interval implementation
-  // ============================================================================
+  /**
+   * @brief Return a slot to the pool.
+   *
+   * @details
+   * The index cell is removed with backward-shift deletion: following
+   * entries of the probe cluster are moved back so that no tombstone is
+   * left behind. Lookups of the remaining timers therefore stay as short
+   * as if the released timer had never existed.
+   *
+   * The slot itself is pushed on an intrusive free list (linked through
+   * its start field), so both release and reuse are O(1). Slot storage
+   * never moves: handles bound to other slots stay valid.
+   *
+   * The hardware timer (esp_timer backend) is stopped between the two
+   * locked steps, as esp_timer_stop() must not run with interrupts masked.
+   * The slot is unindexed and inactive by then but not yet on the free
+   * list, so no other task can claim it meanwhile.
+   */
+  void SlotPool::release(Slot* s) {
+    const uint16_t pos = (uint16_t)(s - _slots);
 
-  Interval::Interval(Id id) : _id(id) {}
+    if (!unindex(s)) return;   // not indexed (already released)
 
-  bool Interval::every(uint32_t period_ms) {
-    Slot* s = getSlot(_id, Kind::Interval);
-    if (!s) return false;
+    hwStop(s);
 
-    const uint32_t now = millis();
+    TableLock lock;
+    resetSlot(s, extra(s));
+    _ids[pos] = 0;
+    s->start  = _freeHead;
+    _freeHead = pos + 1;
+    --_count;
+  }
 
-    // First call: initialize
-    if (!s->active) {
-      s->period = period_ms;
-      s->start  = now;
-      s->active = true;
-      return false;
-    }
+  /**
+   * @brief First step of release(): remove a slot from the index and
+   *        deactivate it, under the table lock.
+   *
+   * @return false if the slot was not indexed.
+   */
+  bool SlotPool::unindex(Slot* s) {
+    TableLock lock;
 
-    // Expiration check (unsigned arithmetic handles wrap-around)
-    if ((uint32_t)(now - s->start) >= s->period) {
-      // Drift-resistant realignment
-      s->start += s->period;
-      return true;
+    const size_t   mask = (size_t(1) << _indexBits) - 1;
+    const uint16_t pos  = (uint16_t)(s - _slots);
+
+    size_t hole = indexHome(_ids[pos], _indexBits);
+    while (_cells[hole] != pos + 1) {
+      if (_cells[hole] == 0) return false;
+      hole = (hole + 1) & mask;
     }
 
-    return false;
-  }
+    // Backward-shift deletion
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    __atomic_store_n(&_shiftSeq, _shiftSeq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+    size_t next = hole;
+    for (;;) {
+      next = (next + 1) & mask;
+      if (_cells[next] == 0) break;
 
-  bool Interval::every(const char* hms) {
-    uint32_t ms;
-    if (!HestiaTempoFormat::parseHMS(hms, ms)) {
-      g_lastError = Error::InvalidFormat;
-      return false;
+      const size_t home = indexHome(_ids[_cells[next] - 1], _indexBits);
+
+      // Entry may move into the hole unless its home lies in (hole, next]
+      const bool stays = (hole <= next)
+        ? (hole < home && home <= next)
+        : (hole < home || home <= next);
+
+      if (!stays) {
+        storeRelease(_cells[hole], _cells[next]);
+        hole = next;
+      }
+    }
+    storeRelease(_cells[hole], (uint16_t)0);
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    storeRelease(_shiftSeq, _shiftSeq + 1);
+#endif
+
+    {
+      SlotWriter w(s);
+      s->active = false;
     }
-    return every(ms);
+    unscheduled(s);
+    return true;
   }
 
   // ============================================================================
-  // OneShot implementation
+  // Deadlines
   // ============================================================================
 
-  OneShot::OneShot(Id id) : _id(id) {}
+  /**
+   * @brief Remaining time of a pending slot.
+   *
+   * @return false if the slot has no future deadline (inactive, or an
+   *         expired OneShot).
+   */
+  static bool pendingRemaining(const Slot& s, Tick now, Tick& rem) {
+    if (s.kind == Kind::RateLimit) return false;   // no deadline
+
+    const SlotTime t = readTime(&s);
+    if (!t.active) return false;
 
-  void OneShot::start(uint32_t duration_ms) {
-    Slot* s = getSlot(_id, Kind::OneShot);
-    if (!s) return;
+    const Tick e = (Tick)(now - t.start);
+    if (e < t.period) {
+      rem = t.period - e;
+      return true;
+    }
 
-    s->period = duration_ms;
-    s->start  = millis();
-    s->active = true;
+    // Overdue Interval: due right now. Expired OneShot: nothing pending.
+    rem = 0;
+    return s.kind == Kind::Interval;
   }
 
-  void OneShot::start(const char* hms) {
-    uint32_t ms;
-    if (!HestiaTempoFormat::parseHMS(hms, ms)) {
-      g_lastError = Error::InvalidFormat;
-      return;
+  namespace detail {
+
+    uint32_t earliestDeadline(const Slot* slots, size_t n, Tick now, size_t& pos) {
+      Tick best = 0;
+      pos = n;
+      for (size_t i = 0; i < n; ++i) {
+        Tick rem;
+        if (pendingRemaining(slots[i], now, rem) && (pos == n || rem < best)) {
+          best = rem;
+          pos  = i;
+        }
+      }
+      if (pos == n) return NO_DEADLINE;
+
+      const uint32_t ms = ticksToMsCeil(best);
+      return (ms == NO_DEADLINE) ? NO_DEADLINE - 1 : ms;
     }
-    start(ms);
-  }
 
-  void OneShot::restart() {
-    Slot* s = getSlot(_id, Kind::OneShot);
-    if (!s || !s->active) return;
+    Tick now() {
+      return clockNow();
+    }
 
-    s->start = millis();
-  }
+    uint32_t groupExpired(const Tick* start, const Tick* period, uint32_t active,
+                          size_t n, Tick now) {
+      // Evaluate every member unconditionally: no branch per member, and the
+      // compiler can vectorize the compares
+      uint32_t mask = 0;
+      for (size_t i = 0; i < n; ++i) {
+        mask |= (uint32_t)((Tick)(now - start[i]) >= period[i]) << i;
+      }
+      return mask & active;
+    }
 
-  void OneShot::cancel() {
-    Slot* s = getSlot(_id, Kind::OneShot);
-    if (!s) return;
+    uint32_t groupDeadline(const Tick* start, const Tick* period, uint32_t active,
+                           size_t n, Tick now) {
+      if (!active) return NO_DEADLINE;
 
-    s->active = false;
-  }
+      Tick best = 0;
+      bool found = false;
+      for (size_t i = 0; i < n; ++i) {
+        if (!(active >> i & 1u)) continue;
 
-  bool OneShot::running() const {
-    Slot* s = getSlot(_id, Kind::OneShot);
-    if (!s || !s->active) return false;
+        const Tick e   = (Tick)(now - start[i]);
+        const Tick rem = (e >= period[i]) ? 0 : (period[i] - e);
+        if (!found || rem < best) {
+          best  = rem;
+          found = true;
+        }
+      }
 
-    return (uint32_t)(millis() - s->start) < s->period;
-  }
+      const uint32_t ms = ticksToMsCeil(best);
+      return (ms == NO_DEADLINE) ? NO_DEADLINE - 1 : ms;
+    }
 
-  bool OneShot::done() const {
-    Slot* s = getSlot(_id, Kind::OneShot);
-    if (!s || !s->active) return false;
+  } // namespace detail
 
-    return (uint32_t)(millis() - s->start) >= s->period;
-  }
+  void SlotPool::scheduled(const Slot* s, Tick now) {
+    DueLock lock(*this);
+    if (!_dueValid) return;   // next query rescans anyway
 
-  uint32_t OneShot::elapsed() const {
-    Slot* s = getSlot(_id, Kind::OneShot);
-    if (!s || !s->active) return 0;
+    const uint16_t pos = (uint16_t)(s - _slots) + 1;
+    if (_due == pos) {
+      // The earliest timer moved: another one may now be earlier
+      _dueValid = false;
+      return;
+    }
+
+    Tick remNew, remDue;
+    if (!pendingRemaining(*s, now, remNew)) return;
+    if (_due == 0 || !pendingRemaining(_slots[_due - 1], now, remDue) || remNew < remDue) {
+      _due = pos;
+    }
+  }
 
-    return (uint32_t)(millis() - s->start);
+  void SlotPool::unscheduled(const Slot* s) {
+    DueLock lock(*this);
+    if (_due == (uint16_t)(s - _slots) + 1) {
+      _dueValid = false;
+    }
   }
 
-  uint32_t OneShot::remaining() const {
-    Slot* s = getSlot(_id, Kind::OneShot);
-    if (!s || !s->active) return 0;
+  uint32_t SlotPool::nextDeadline() {
+    const Tick now = clockNow();
+    DueLock lock(*this);
 
-    const uint32_t e = (uint32_t)(millis() - s->start);
-    return (e >= s->period) ? 0 : (s->period - e);
-  }
+    if (_dueValid) {
+      if (_due == 0) return NO_DEADLINE;
 
-  // ============================================================================
-  // Facade entry points
-  // ============================================================================
+      Tick rem;
+      if (pendingRemaining(_slots[_due - 1], now, rem)) {
+        const uint32_t ms = ticksToMsCeil(rem);
+        return (ms == NO_DEADLINE) ? NO_DEADLINE - 1 : ms;
+      }
+    }
 
-  Interval interval(Id id) {
-    return Interval(id);
+    // Cached slot moved or expired: rescan the slots handed out so far
+    size_t pos;
+    const uint32_t ms = detail::earliestDeadline(_slots, _fresh, now, pos);
+    _due      = (pos < _fresh) ? (uint16_t)(pos + 1) : 0;
+    _dueValid = true;
+    return ms;
   }
 
-  OneShot oneShot(Id id) {
-    return OneShot(id);
+  uint32_t nextDeadline() {
+    uint32_t best = NO_DEADLINE;
+    for (SlotPool* p = loadAcquire(g_pools); p; p = p->nextPool()) {
+      const uint32_t rem = p->nextDeadline();
+      if (rem < best) best = rem;
+    }
+    return best;
   }
 
   // ============================================================================
-  // Formatting facade
+  // Slot operations
+  // ============================================================================
+  //
+  // The timing logic operates on a resolved slot, so that facades (which look
+  // the slot up on every call) and handles (which cache it) share one
+  // implementation. All operations accept nullptr (lookup failure).
+
+  // ============================================================================
+  // Lateness statistics
+  // ============================================================================
+
+#if defined(HESTIA_TEMPO_STATS)
+  /**
+   * @brief Record one expiry handled `late` ticks after its deadline.
+   */
+  static void recordLateness(Slot* s, Tick late) {
+    Stats& st = s->stats;
+    const uint32_t l = (late > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)late;
+
+    ++st.count;
+    st.sumLate += l;
+    if (l < st.minLate) st.minLate = l;
+    if (l > st.maxLate) st.maxLate = l;
+
+    // Bucket b holds lateness below 2^b ms
+    uint32_t ms = l / (uint32_t)TICKS_PER_MS;
+    size_t   b  = 0;
+    while (ms > 0 && b < Stats::BUCKETS - 1) {
+      ms >>= 1;
+      ++b;
+    }
+    if (st.histogram[b] != 0xFFFF) ++st.histogram[b];
+  }
+#else
+  static inline void recordLateness(Slot*, Tick) {}
+#endif
+
+  /**
+   * @brief Advance an expired Interval according to its catch-up policy.
+   *
+   * @details
+   * Must be called inside a SlotWriter. Records the number of missed
+   * periods in `overruns`.
+   *
+   * @return true if the phase was reset (the hardware timer must be re-armed).
+   */
+  static bool slotAdvance(Slot* s, Tick now) {
+    const Tick late = (Tick)(now - s->start);
+    Tick       k    = (s->period > 0) ? late / s->period : 1;
+    if (k == 0) k = 1;   // hardware expiry flagged just ahead of the clock
+
+    recordLateness(s, (late > s->period) ? (Tick)(late - s->period) : 0);
+
+    s->overruns = (k - 1 > 0xFFFF) ? 0xFFFF : (uint16_t)(k - 1);
+
+    switch ((CatchUp)s->catchUp) {
+      case CatchUp::Skip:
+        s->start += s->period * k;
+        hwConsumeAll(s);
+        return false;
+
+      case CatchUp::Coalesce:
+        s->start = now;
+        return true;
+
+      case CatchUp::Burst:
+      default:
+        s->start += s->period;
+        hwConsume(s);
+        return false;
+    }
+  }
+
+  /**
+   * @brief Phase offset of a spread Interval, in [0, period).
+   *
+   * @details
+   * Derived from the Id alone (Fibonacci hashing), so it is deterministic
+   * and intervals sharing a period land on different deadlines.
+   */
+  static inline Tick spreadOffset(Id id, Tick period) {
+    const uint32_t h = id * 0x9E3779B1u;
+    return (Tick)(((uint64_t)h * (uint64_t)period) >> 32);
+  }
+
+  static bool slotEvery(Slot* s, SlotPool* pool, Tick period,
+                        Phase phase = Phase::Aligned) {
+    if (!s) return false;
+
+    const Tick now = clockNow();
+
+    // Fast path (read-only): running and not expired yet
+    const SlotTime t = readTime(s);
+    if (t.active && !slotExpired(s, t, now)) return false;
+
+    bool fired   = false;
+    bool changed = false;
+    bool rearm   = false;
+    Tick first   = 0;
+    {
+      SlotWriter w(s);
+
+      if (!s->active) {
+        // First call: initialize (a spread interval starts part-way
+        // through its first period)
+        const Tick offset = (phase == Phase::Spread) ? spreadOffset(s->id, period) : 0;
+        s->period = period;
+        s->start  = now - offset;
+        s->active = true;
+        first     = period - offset;
+        changed   = true;
+      } else if (slotExpired(s, readTimeUnlocked(s), now)) {
+        // Expiration check (unsigned arithmetic handles wrap-around)
+        // Drift-resistant realignment
+        rearm     = slotAdvance(s, now);
+        fired     = true;
+        changed   = true;
+      }
+    }
+
+    if (changed && (!fired || rearm)) hwArm(s, true, first);
+    if (changed && pool) pool->scheduled(s, now);
+    return fired;
+  }
+
+  static void slotStart(Slot* s, SlotPool* pool, Tick duration,
+                        Release release = Release::Keep) {
+    if (!s) return;
+
+    const Tick now = clockNow();
+    {
+      SlotWriter w(s);
+      s->period  = duration;
+      s->start   = now;
+      s->active   = true;
+      s->release  = (release == Release::OnDone);
+      s->consumed = false;
+    }
+    hwArm(s, false);
+    if (pool) pool->scheduled(s, now);
+  }
+
+  static void slotCatchUp(Slot* s, CatchUp policy) {
+    if (!s) return;
+
+    SlotWriter w(s);   // shares a byte with the flags
+    s->catchUp = (uint8_t)policy;
+  }
+
+  static void slotRestart(Slot* s, SlotPool* pool) {
+    if (!s) return;
+
+    const Tick now = clockNow();
+    {
+      SlotWriter w(s);
+      // An expiry consumed by poll() leaves the timer restartable, a
+      // cancelled one does not
+      if (!s->active && !s->consumed) return;
+      s->start    = now;
+      s->active   = true;
+      s->consumed = false;
+    }
+    hwArm(s, false);
+    if (pool) pool->scheduled(s, now);
+  }
+
+  static void slotCancel(Slot* s, SlotPool* pool) {
+    if (!s) return;
+
+    {
+      SlotWriter w(s);
+      s->active   = false;
+      s->consumed = false;
+    }
+    hwStop(s);
+    if (pool) pool->unscheduled(s);
+  }
+
+  /**
+   * @brief Release a slot (registry slots, which have no pool, are only
+   *        deactivated).
+   */
+  static void slotRelease(Slot* s, SlotPool* pool) {
+    if (!s) return;
+    if (pool) {
+      pool->release(s);
+    } else {
+      {
+        SlotWriter w(s);
+        s->active   = false;
+        s->consumed = false;
+      }
+      hwStop(s);
+    }
+  }
+
+  /**
+   * @brief Claim an expiry: deactivate the slot if it is still active and
+   *        expired at `now`.
+   *
+   * @return true for exactly one caller per expiry.
+   */
+  static bool slotClaimExpiry(Slot* s, Tick now) {
+    SlotWriter w(s);
+    if (!s->active || !slotExpired(s, readTimeUnlocked(s), now)) return false;
+    s->active   = false;
+    s->consumed = true;
+    return true;
+  }
+
+  static bool slotRunning(const Slot* s) {
+    if (!s) return false;
+
+    const SlotTime t = readTime(s);
+    return t.active && !slotExpired(s, t, clockNow());
+  }
+
+  static bool slotDone(Slot* s, SlotPool* pool) {
+    if (!s) return false;
+
+    const Tick     now = clockNow();
+    const SlotTime t   = readTime(s);
+    if (!t.active || !slotExpired(s, t, now)) return false;
+
+    // The flag is taken from the snapshot: a concurrent claim may already
+    // have reset the slot
+    if (!t.release) return true;
+
+    // Transient timers give their slot back once expiry is observed
+    if (!slotClaimExpiry(s, now)) return false;
+    slotRelease(s, pool);
+    return true;
+  }
+
+  static Tick slotElapsed(const Slot* s) {
+    if (!s) return 0;
+
+    const SlotTime t = readTime(s);
+    return t.active ? (Tick)(clockNow() - t.start) : 0;
+  }
+
+  static Tick slotRemaining(const Slot* s) {
+    if (!s) return 0;
+
+    const SlotTime t = readTime(s);
+    if (!t.active) return 0;
+
+    const Tick e = (Tick)(clockNow() - t.start);
+    return (e >= t.period) ? 0 : (t.period - e);
+  }
+
+  uint32_t detail::invalidDuration() {
+    setError(Error::InvalidFormat);
+    return NO_DEADLINE;   // never fires, unlike a period of 0
+  }
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  /**
+   * @brief Parse a duration string, recording InvalidFormat on failure.
+   */
+  static bool parseDuration(const char* hms, uint32_t& ms) {
+    if (!detail::parseDuration(hms, (size_t)-1, ms)) {
+      setError(Error::InvalidFormat);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Parse cache of a pool slot (nullptr if the pool has no cold data).
+   */
+  static inline ParseCache* parseCache(SlotPool* pool, Slot* s) {
+    SlotExtra* x = (pool && s) ? pool->extra(s) : nullptr;
+    return x ? &x->cache : nullptr;
+  }
+
+  /**
+   * @brief Parse a duration string through the slot's parse cache.
+   *
+   * @param pool    Pool owning the slot (nullptr for Registry and TimerArray
+   *                handles).
+   * @param own     Cache of a pool-less slot, kept by its Registry or
+   *                TimerArray; nullptr for pool slots.
+   * @param s       Existing slot or nullptr; allocated with `create()` after
+   *                a successful parse if still missing.
+   * @param create  Slot allocator, only called on a cache miss.
+   *
+   * @details
+   * The cache is keyed by the string's address: string literals never
+   * change, so a hit skips parsing altogether. Writers are serialized
+   * (SlotWriter) and clear the key first, so a reader never pairs a key
+   * with another string's value.
+   */
+  template <typename Create>
+  static bool cachedDuration(SlotPool* pool, ParseCache* own, Slot*& s, const char* hms,
+                             uint32_t& ms, Create create) {
+    ParseCache* c = own ? own : parseCache(pool, s);
+    if (c && hms && loadAcquire(c->src) == hms) {
+      ms = loadAcquire(c->ms);
+      if (loadAcquire(c->src) == hms) return true;
+    }
+
+    if (!parseDuration(hms, ms)) return false;
+
+    if (!s) s = create();
+    if (!own) c = parseCache(pool, s);
+    if (c && s) {
+      SlotWriter w(s);
+      storeRelease(c->src, (const char*)nullptr);
+      storeRelease(c->ms, ms);
+      storeRelease(c->src, hms);
+    }
+    return true;
+  }
+#endif
+
+  // ============================================================================
+  // Dispatcher
+  // ============================================================================
+
+  size_t SlotPool::poll(Tick now) {
+    size_t fired = 0;
+    if (!_extra) return 0;   // no handler can be registered
+
+    for (size_t i = 0; i < _fresh; ++i) {
+      const SlotExtra& x = _extra[i];
+      if (!x.handler) continue;
+
+      Slot& s = _slots[i];
+
+      const SlotTime t = readTime(&s);
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+      if (s.direct) continue;   // dispatched by the hardware timer
+#endif
+      if (!t.active || !slotExpired(&s, t, now)) continue;
+
+      // Capture the dispatch target before the handler can modify the slot
+      const Handler fn  = x.handler;
+      void* const   ctx = x.ctx;
+      const Id      id  = s.id;
+
+      if (s.kind == Kind::Interval) {
+        bool due;
+        bool rearm = false;
+        {
+          SlotWriter w(&s);
+          due = s.active && slotExpired(&s, readTimeUnlocked(&s), now);
+          if (due) rearm = slotAdvance(&s, now);
+        }
+        if (!due) continue;
+        if (rearm) hwArm(&s, true);
+        scheduled(&s, now);
+      } else {
+        if (!slotClaimExpiry(&s, now)) continue;
+#if defined(HESTIA_TEMPO_STATS)
+        const Tick e = (Tick)(now - s.start);
+        recordLateness(&s, (e > s.period) ? (Tick)(e - s.period) : 0);
+#endif
+        if (s.release) release(&s);
+        else           unscheduled(&s);
+      }
+
+      fn(id, ctx);
+      ++fired;
+    }
+
+    return fired;
+  }
+
+  size_t poll() {
+    const Tick now = clockNow();
+
+    size_t fired = 0;
+    for (SlotPool* p = loadAcquire(g_pools); p; p = p->nextPool()) {
+      fired += p->poll(now);
+    }
+    return fired;
+  }
+
+#if defined(HESTIA_TEMPO_STATS)
+  // ============================================================================
+  // Statistics read-out
+  // ============================================================================
+
+  size_t SlotPool::visitStats(StatsVisitor fn, void* ctx) const {
+    if (!fn) return 0;
+
+    size_t n = 0;
+    for (size_t i = 0; i < _fresh; ++i) {
+      const Slot& s = _slots[i];
+      if (s.kind == Kind::None) continue;   // on the free list
+      fn(s.id, s.kind, s.stats, ctx);
+      ++n;
+    }
+    return n;
+  }
+
+  void SlotPool::resetStats() {
+    for (size_t i = 0; i < _fresh; ++i) _slots[i].stats = Stats{};
+  }
+
+  size_t visitStats(SlotPool::StatsVisitor fn, void* ctx) {
+    size_t n = 0;
+    for (SlotPool* p = loadAcquire(g_pools); p; p = p->nextPool()) {
+      n += p->visitStats(fn, ctx);
+    }
+    return n;
+  }
+
+  void resetStats() {
+    for (SlotPool* p = loadAcquire(g_pools); p; p = p->nextPool()) p->resetStats();
+  }
+#endif
+
+  // ============================================================================
+  // Snapshot
+  // ============================================================================
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  static uint32_t bucketWait(const Slot* s, const SlotExtra* x, Tick now);
+#endif
+
+  size_t SlotPool::snapshot(SnapshotVisitor fn, void* ctx, Tick now) const {
+    if (!fn) return 0;
+
+    size_t n = 0;
+    for (size_t i = 0; i < _fresh; ++i) {
+      const Slot& s = _slots[i];
+      if (s.kind == Kind::None) continue;   // on the free list
+
+      TimerInfo info = { s.id, s.kind, false, 0, 0, s.overruns };
+      const SlotTime t = readTime(&s);
+      info.active = t.active;
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+      if (s.kind == Kind::RateLimit) {
+        info.remaining = bucketWait(&s, extra(&s), now);
+      } else
+#endif
+      if (t.active) {
+        const Tick e = (Tick)(now - t.start);
+        info.elapsed   = ticksToMs(e);
+        info.remaining = (e >= t.period) ? 0 : ticksToMsCeil(t.period - e);
+      }
+
+      fn(info, ctx);
+      ++n;
+    }
+    return n;
+  }
+
+  size_t snapshot(SlotPool::SnapshotVisitor fn, void* ctx) {
+    const Tick now = clockNow();
+
+    size_t n = 0;
+    for (SlotPool* p = loadAcquire(g_pools); p; p = p->nextPool()) {
+      n += p->snapshot(fn, ctx, now);
+    }
+    return n;
+  }
+
+  // ============================================================================
+  // Interval implementation
+  // ============================================================================
+
+  Interval::Interval(Id id) : _pool(&g_defaultPool), _id(id) {}
+
+  Interval::Interval(SlotPool& pool, Id id) : _pool(&pool), _id(id) {}
+
+  bool Interval::every(uint32_t period_ms) {
+    return slotEvery(_pool->slot(_id, Kind::Interval), _pool, msToTicks(period_ms));
+  }
+
+  bool Interval::every(uint32_t period_ms, Phase phase) {
+    return slotEvery(_pool->slot(_id, Kind::Interval), _pool, msToTicks(period_ms), phase);
+  }
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  bool Interval::every(const char* hms) {
+    Slot*    s = _pool->slot(_id, Kind::Interval, false);
+    uint32_t ms;
+    if (!cachedDuration(_pool, nullptr, s, hms, ms, [this] { return _pool->slot(_id, Kind::Interval); })) {
+      return false;
+    }
+    return slotEvery(s, _pool, msToTicks(ms));
+  }
+#endif
+
+  void Interval::release() {
+    slotRelease(_pool->slot(_id, Kind::Interval, false), _pool);
+  }
+
+  uint32_t Interval::remaining() const {
+    return ticksToMsCeil(slotRemaining(_pool->slot(_id, Kind::Interval, false)));
+  }
+
+  void Interval::onEvery(uint32_t period_ms, Handler fn, void* ctx) {
+    Slot* s = _pool->slot(_id, Kind::Interval);
+    if (!s) return;
+
+    SlotExtra* x = _pool->extra(s);
+    x->handler = fn;
+    x->ctx     = ctx;
+
+    if (readTime(s).active) {
+      const Tick now = clockNow();
+      Tick first;
+      {
+        SlotWriter w(s);
+        s->period = msToTicks(period_ms);
+        const Tick e = (Tick)(now - s->start);
+        first = (e < s->period) ? s->period - e : 1;   // overdue: due now
+      }
+      hwArm(s, true, first);   // keep the phase: first expiry at start + period
+      _pool->scheduled(s, now);
+    } else {
+      slotEvery(s, _pool, msToTicks(period_ms));
+    }
+  }
+
+  void Interval::catchUp(CatchUp policy) {
+    slotCatchUp(_pool->slot(_id, Kind::Interval), policy);
+  }
+
+  uint32_t Interval::overruns() const {
+    const Slot* s = _pool->slot(_id, Kind::Interval, false);
+    return s ? s->overruns : 0;
+  }
+
+#if defined(HESTIA_TEMPO_STATS)
+  Stats Interval::stats() const {
+    const Slot* s = _pool->slot(_id, Kind::Interval, false);
+    return s ? s->stats : Stats{};
+  }
+#endif
+
+  // ============================================================================
+  // OneShot implementation
+  // ============================================================================
+  //
+  // Only start() allocates a slot. Queries on an unknown Id behave as for an
+  // inactive timer, so polling a released timer does not re-allocate it.
+
+  OneShot::OneShot(Id id) : _pool(&g_defaultPool), _id(id) {}
+
+  OneShot::OneShot(SlotPool& pool, Id id) : _pool(&pool), _id(id) {}
+
+  void OneShot::start(uint32_t duration_ms) {
+    slotStart(_pool->slot(_id, Kind::OneShot), _pool, msToTicks(duration_ms));
+  }
+
+  void OneShot::start(uint32_t duration_ms, Release release) {
+    slotStart(_pool->slot(_id, Kind::OneShot), _pool, msToTicks(duration_ms), release);
+  }
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  void OneShot::start(const char* hms) {
+    Slot*    s = _pool->slot(_id, Kind::OneShot, false);
+    uint32_t ms;
+    if (!cachedDuration(_pool, nullptr, s, hms, ms, [this] { return _pool->slot(_id, Kind::OneShot); })) {
+      return;
+    }
+    slotStart(s, _pool, msToTicks(ms));
+  }
+#endif
+
+  void OneShot::restart() {
+    slotRestart(_pool->slot(_id, Kind::OneShot, false), _pool);
+  }
+
+  void OneShot::cancel() {
+    slotCancel(_pool->slot(_id, Kind::OneShot, false), _pool);
+  }
+
+  void OneShot::release() {
+    slotRelease(_pool->slot(_id, Kind::OneShot, false), _pool);
+  }
+
+  bool OneShot::running() const {
+    return slotRunning(_pool->slot(_id, Kind::OneShot, false));
+  }
+
+  bool OneShot::done() const {
+    return slotDone(_pool->slot(_id, Kind::OneShot, false), _pool);
+  }
+
+  uint32_t OneShot::elapsed() const {
+    return ticksToMs(slotElapsed(_pool->slot(_id, Kind::OneShot, false)));
+  }
+
+  uint32_t OneShot::remaining() const {
+    return ticksToMsCeil(slotRemaining(_pool->slot(_id, Kind::OneShot, false)));
+  }
+
+  void OneShot::onDone(Handler fn, void* ctx) {
+    Slot* s = _pool->slot(_id, Kind::OneShot);
+    if (!s) return;
+
+    SlotExtra* x = _pool->extra(s);
+    x->handler = fn;
+    x->ctx     = ctx;
+  }
+
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+  // The dispatch mode is set before the handler so the timer task never sees
+  // a handler with a stale mode.
+
+  void Interval::onEvery(uint32_t period_ms, Handler fn, void* ctx, Dispatch dispatch) {
+    Slot* s = _pool->slot(_id, Kind::Interval);
+    if (!s) return;
+
+    s->direct = (dispatch == Dispatch::Timer);
+    onEvery(period_ms, fn, ctx);
+  }
+
+  void OneShot::onDone(Handler fn, void* ctx, Dispatch dispatch) {
+    Slot* s = _pool->slot(_id, Kind::OneShot);
+    if (!s) return;
+
+    s->direct = (dispatch == Dispatch::Timer);
+    onDone(fn, ctx);
+  }
+#endif
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  // ============================================================================
+  // RateLimit implementation
+  // ============================================================================
+  //
+  // Tokens are counted in units of 1 / (1000 * TICKS_PER_MS) token, so one
+  // tick of refill at `rate` tokens/s adds exactly `rate` units: refill is
+  // a multiplication, with no division and no rounding carried over.
+
+  static constexpr Tick TOKEN = (Tick)1000 * TICKS_PER_MS;
+
+  /**
+   * @brief Bucket content after refilling up to `now` (units).
+   */
+  static Tick bucketLevel(const SlotTime& t, Tick now, uint32_t rate, Tick cap) {
+    if (t.tokens >= cap) return cap;
+
+    const Tick e    = (Tick)(now - t.start);
+    const Tick room = cap - t.tokens;
+    if (rate && e > room / rate) return cap;   // also avoids e * rate overflow
+    return t.tokens + e * rate;
+  }
+
+  /**
+   * @brief Milliseconds until a bucket holds a token (0 if unknown).
+   *
+   * @param x  Cold data of the bucket's slot (holds the rate).
+   */
+  static uint32_t bucketWait(const Slot* s, const SlotExtra* x, Tick now) {
+    if (!s || !x) return 0;
+
+    const SlotTime t    = readTime(s);
+    const uint32_t rate = loadAcquire(x->rate);
+    if (!t.active) return 0;
+
+    const Tick level = bucketLevel(t, now, rate, TOKEN);
+    if (level >= TOKEN) return 0;
+    if (rate == 0) return NO_DEADLINE;
+
+    const Tick ticks = (TOKEN - level + rate - 1) / rate;
+    return ticksToMsCeil(ticks);
+  }
+
+  RateLimit::RateLimit(Id id)
+    : RateLimit(g_defaultPool, id) {}
+
+  RateLimit::RateLimit(SlotPool& pool, Id id)
+    : _pool(&pool), _id(id) {}
+
+  bool RateLimit::allow(uint32_t rate, uint32_t burst) {
+    Slot* s = _pool->slot(_id, Kind::RateLimit);
+    if (!s) return false;
+
+    static constexpr Tick MAX_TOKENS = (Tick)~(Tick)0 / TOKEN;
+    const Tick cap = ((Tick)burst > MAX_TOKENS ? MAX_TOKENS : (Tick)burst) * TOKEN;
+    const Tick now = clockNow();
+
+    SlotWriter w(s);
+    const Tick level = s->active ? bucketLevel(readTimeUnlocked(s), now, rate, cap) : cap;
+
+    s->start  = now;
+    s->active = true;
+    storeRelease(_pool->extra(s)->rate, rate);
+
+    const bool ok = level >= TOKEN;
+    s->tokens = ok ? level - TOKEN : level;
+    return ok;
+  }
+
+  uint32_t RateLimit::nextToken() const {
+    const Slot* s = _pool->slot(_id, Kind::RateLimit, false);
+    return bucketWait(s, s ? _pool->extra(s) : nullptr, clockNow());
+  }
+
+  void RateLimit::reset() {
+    Slot* s = _pool->slot(_id, Kind::RateLimit, false);
+    if (!s) return;
+
+    SlotWriter w(s);
+    s->active = false;   // refilled on the next allow()
+  }
+
+  void RateLimit::release() {
+    Slot* s = _pool->slot(_id, Kind::RateLimit, false);
+    if (s) _pool->release(s);
+  }
+#endif
+
+  // ============================================================================
+  // Cached handles
+  // ============================================================================
+  //
+  // A handle revalidates its cached slot with two compares. If the slot was
+  // released (and possibly reused by another timer), the handle looks its Id
+  // up again. Registry handles (no pool) always own their slot.
+
+  IntervalHandle::IntervalHandle(Id id)
+    : IntervalHandle(g_defaultPool, id) {}
+
+  IntervalHandle::IntervalHandle(SlotPool& pool, Id id)
+    : _pool(&pool), _id(id), _slot(pool.slot(id, Kind::Interval)) {}
+
+  Slot* IntervalHandle::slot(bool create) const {
+    if (_pool && (!_slot || _slot->id != _id || _slot->kind != Kind::Interval)) {
+      _slot = _pool->slot(_id, Kind::Interval, create);
+    }
+    return _slot;
+  }
+
+  bool IntervalHandle::every(uint32_t period_ms) {
+    return slotEvery(slot(true), _pool, msToTicks(period_ms));
+  }
+
+  bool IntervalHandle::every(uint32_t period_ms, Phase phase) {
+    return slotEvery(slot(true), _pool, msToTicks(period_ms), phase);
+  }
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  bool IntervalHandle::every(const char* hms) {
+    Slot*    s = slot(false);
+    uint32_t ms;
+    if (!cachedDuration(_pool, _cache, s, hms, ms, [this] { return slot(true); })) return false;
+    return slotEvery(s, _pool, msToTicks(ms));
+  }
+#endif
+
+  void IntervalHandle::catchUp(CatchUp policy) {
+    slotCatchUp(slot(true), policy);
+  }
+
+  uint32_t IntervalHandle::overruns() const {
+    const Slot* s = slot(false);
+    return s ? s->overruns : 0;
+  }
+
+  void IntervalHandle::release() {
+    slotRelease(slot(false), _pool);
+    if (_pool) _slot = nullptr;
+  }
+
+  uint32_t IntervalHandle::remaining() const {
+    return ticksToMsCeil(slotRemaining(slot(false)));
+  }
+
+  OneShotHandle::OneShotHandle(Id id)
+    : OneShotHandle(g_defaultPool, id) {}
+
+  OneShotHandle::OneShotHandle(SlotPool& pool, Id id)
+    : _pool(&pool), _id(id), _slot(pool.slot(id, Kind::OneShot)) {}
+
+  Slot* OneShotHandle::slot(bool create) const {
+    if (_pool && (!_slot || _slot->id != _id || _slot->kind != Kind::OneShot)) {
+      _slot = _pool->slot(_id, Kind::OneShot, create);
+    }
+    return _slot;
+  }
+
+  void OneShotHandle::start(uint32_t duration_ms) {
+    slotStart(slot(true), _pool, msToTicks(duration_ms));
+  }
+
+  void OneShotHandle::start(uint32_t duration_ms, Release release) {
+    slotStart(slot(true), _pool, msToTicks(duration_ms), release);
+  }
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  void OneShotHandle::start(const char* hms) {
+    Slot*    s = slot(false);
+    uint32_t ms;
+    if (!cachedDuration(_pool, _cache, s, hms, ms, [this] { return slot(true); })) return;
+    slotStart(s, _pool, msToTicks(ms));
+  }
+#endif
+
+  void OneShotHandle::restart() {
+    slotRestart(slot(false), _pool);
+  }
+
+  void OneShotHandle::cancel() {
+    slotCancel(slot(false), _pool);
+  }
+
+  void OneShotHandle::release() {
+    slotRelease(slot(false), _pool);
+    if (_pool) _slot = nullptr;
+  }
+
+  bool OneShotHandle::running() const {
+    return slotRunning(slot(false));
+  }
+
+  bool OneShotHandle::done() const {
+    return slotDone(slot(false), _pool);
+  }
+
+  uint32_t OneShotHandle::elapsed() const {
+    return ticksToMs(slotElapsed(slot(false)));
+  }
+
+  uint32_t OneShotHandle::remaining() const {
+    return ticksToMsCeil(slotRemaining(slot(false)));
+  }
+
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+  // ============================================================================
+  // Microsecond variants
+  // ============================================================================
+
+  bool Interval::every_us(Tick period_us) {
+    return slotEvery(_pool->slot(_id, Kind::Interval), _pool, period_us);
+  }
+
+  Tick Interval::remaining_us() const {
+    return slotRemaining(_pool->slot(_id, Kind::Interval, false));
+  }
+
+  void OneShot::start_us(Tick duration_us) {
+    slotStart(_pool->slot(_id, Kind::OneShot), _pool, duration_us);
+  }
+
+  Tick OneShot::elapsed_us() const {
+    return slotElapsed(_pool->slot(_id, Kind::OneShot, false));
+  }
+
+  Tick OneShot::remaining_us() const {
+    return slotRemaining(_pool->slot(_id, Kind::OneShot, false));
+  }
+
+  bool IntervalHandle::every_us(Tick period_us) {
+    return slotEvery(slot(true), _pool, period_us);
+  }
+
+  Tick IntervalHandle::remaining_us() const {
+    return slotRemaining(slot(false));
+  }
+
+  void OneShotHandle::start_us(Tick duration_us) {
+    slotStart(slot(true), _pool, duration_us);
+  }
+
+  Tick OneShotHandle::elapsed_us() const {
+    return slotElapsed(slot(false));
+  }
+
+  Tick OneShotHandle::remaining_us() const {
+    return slotRemaining(slot(false));
+  }
+#endif
+
+  // ============================================================================
+  // Facade entry points
+  // ============================================================================
+
+  Interval interval(Id id) {
+    return Interval(id);
+  }
+
+  OneShot oneShot(Id id) {
+    return OneShot(id);
+  }
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  RateLimit rateLimit(Id id) {
+    return RateLimit(id);
+  }
+#endif
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  // ============================================================================
+  // Formatting facade
   // ============================================================================
 
   const char* remainingStr(Id id, Format fmt) {
@@ -266,12 +1778,21 @@ namespace Tempo {
     );
   }
 
+  size_t remainingStr(Id id, char* out, size_t len, Format fmt) {
+    return HestiaTempoFormat::remainingStr(id, out, len, fmt);
+  }
+
+  size_t elapsedStr(Id id, char* out, size_t len, Format fmt) {
+    return HestiaTempoFormat::elapsedStr(id, out, len, fmt);
+  }
+
   // ============================================================================
   // Error
   // ============================================================================
   Error lastError() {
   return g_lastError;
   }
+#endif
 
 
 } // namespace Tempo
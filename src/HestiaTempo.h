@@ -42,10 +42,167 @@
  * and logging. The core engine always operates on milliseconds internally.
  *
  * @warning
- * Formatting helpers return pointers to internal static buffers and are not
- * re-entrant. Do not use concurrently from multiple threads/ISRs.
+ * The pointer-returning formatting helpers use internal static buffers and
+ * are not re-entrant; the overloads taking a caller buffer are.
  */
 
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/**
+ * @brief Size of the default slot pool.
+ *
+ * @details
+ * Override from the build system (e.g. `-D HESTIA_TEMPO_MAX_SLOTS=64`).
+ * The value must be identical for every translation unit.
+ */
+#ifndef HESTIA_TEMPO_MAX_SLOTS
+#define HESTIA_TEMPO_MAX_SLOTS 32
+#endif
+
+/**
+ * @brief Engine time base.
+ *
+ * @details
+ * By default the engine counts 32-bit milliseconds from millis().
+ * Defining HESTIA_TEMPO_TIMEBASE_US (for every translation unit) switches it
+ * to 64-bit microseconds (esp_timer_get_time() on ESP32, extended micros()
+ * elsewhere), and enables the `_us` methods of Interval / OneShot.
+ *
+ * The millisecond API is unchanged in both modes.
+ */
+
+/**
+ * @brief Clock policy (compile time).
+ *
+ * @details
+ * HESTIA_TEMPO_CLOCK names the Tempo::clocks policy the engine reads, for
+ * every translation unit (e.g. `-D HESTIA_TEMPO_CLOCK=Micros`):
+ *  - Millis   : millis() (default)
+ *  - Micros   : micros(), extended to 64 bits (default with the µs time base)
+ *  - EspTimer : esp_timer_get_time() (ESP32; default with the µs time base)
+ *  - Virtual  : Tempo::VirtualClock, advanced manually (default without
+ *               Arduino; HESTIA_TEMPO_CLOCK_VIRTUAL is a shorthand)
+ *  - Custom   : `Tempo::Tick Tempo::clocks::Custom::now()` defined by the
+ *               application (link-time hook)
+ *
+ * The policy is called directly, so production builds pay no indirect call.
+ *
+ * HESTIA_TEMPO_CLOCK_SCALE (default 1) multiplies a real clock, to run real
+ * time accelerated in soak simulations. The Virtual clock is not scaled.
+ */
+#if !defined(ARDUINO) && !defined(HESTIA_TEMPO_CLOCK_VIRTUAL) && !defined(HESTIA_TEMPO_CLOCK)
+#define HESTIA_TEMPO_CLOCK_VIRTUAL
+#endif
+
+#ifndef HESTIA_TEMPO_CLOCK
+#if defined(HESTIA_TEMPO_CLOCK_VIRTUAL)
+#define HESTIA_TEMPO_CLOCK Virtual
+#elif defined(HESTIA_TEMPO_TIMEBASE_US) && defined(ARDUINO_ARCH_ESP32)
+#define HESTIA_TEMPO_CLOCK EspTimer
+#elif defined(HESTIA_TEMPO_TIMEBASE_US)
+#define HESTIA_TEMPO_CLOCK Micros
+#else
+#define HESTIA_TEMPO_CLOCK Millis
+#endif
+#endif
+
+#ifndef HESTIA_TEMPO_CLOCK_SCALE
+#define HESTIA_TEMPO_CLOCK_SCALE 1
+#endif
+
+/**
+ * @brief Multi-task / dual-core safety.
+ *
+ * @details
+ * Defining HESTIA_TEMPO_THREAD_SAFE (for every translation unit) makes the
+ * engine safe to use from several FreeRTOS tasks, on either core:
+ *  - Slot lookups stay lock-free; only slot allocation and release are
+ *    serialized (ESP32 spinlock), so an Id can never be claimed twice
+ *  - Slot timestamps are published through a per-slot sequence counter, so
+ *    lock-free readers never observe a torn start / period pair; writers
+ *    (start(), rearm, cancel()) lock only the slot they change, and each
+ *    pool locks its own deadline cache
+ *  - An expiry reported by every() / done() / poll() is claimed exactly once
+ *  - The frame timestamp (beginFrame()) is per task
+ *
+ * The engine is never ISR-safe.
+ */
+
+/**
+ * @brief Timer lateness statistics (instrumentation).
+ *
+ * @details
+ * Defining HESTIA_TEMPO_STATS (for every translation unit) makes each slot
+ * record how late its expiries were handled: min / max / mean lateness, an
+ * expiry count and a small histogram (Tempo::Stats). Read them with
+ * Interval::stats() or Tempo::visitStats().
+ *
+ * Without the flag no field, branch or function is compiled in.
+ */
+
+/**
+ * @brief Code-section profiler.
+ *
+ * @details
+ * Defining HESTIA_TEMPO_PROFILE enables Tempo::Profile / TEMPO_PROFILE(id),
+ * which time a scope with micros() and accumulate count / min / max / mean
+ * per Id in a private table of HESTIA_TEMPO_PROFILE_SLOTS entries (hashed
+ * like the timer pools). Without the flag TEMPO_PROFILE() expands to nothing.
+ */
+#ifndef HESTIA_TEMPO_PROFILE_SLOTS
+#define HESTIA_TEMPO_PROFILE_SLOTS 16
+#endif
+
+/**
+ * @brief Hardware-timer backend (ESP32 only).
+ *
+ * @details
+ * Defining HESTIA_TEMPO_BACKEND_ESP_TIMER (for every translation unit) arms
+ * an esp_timer for each started OneShot / Interval. On expiry the timer
+ * flags the slot, so done() / every() / poll() become O(1) flag reads and
+ * expiries are not delayed by a blocked loop(). Handlers may optionally be
+ * dispatched straight from the esp_timer task (Dispatch::Timer).
+ *
+ * The facade API is unchanged. Each slot creates its esp_timer once, on
+ * first use, and reuses it afterwards (including across release / reuse).
+ *
+ * The esp_timer task writes slots concurrently with loop(), so the backend
+ * implies HESTIA_TEMPO_THREAD_SAFE.
+ */
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER) && !defined(HESTIA_TEMPO_THREAD_SAFE)
+#define HESTIA_TEMPO_THREAD_SAFE
+#endif
+
+/**
+ * @brief Deep-sleep persistent pool (ESP32 only).
+ *
+ * @details
+ * Defining HESTIA_TEMPO_RTC_POOL adds Tempo::rtcPool(), a pool of
+ * HESTIA_TEMPO_RTC_SLOTS timers kept in RTC memory. Its timers keep running
+ * across deep sleep: on the first access after a wake-up the pool is
+ * re-based on the RTC timer, with nothing to rebuild.
+ */
+#ifndef HESTIA_TEMPO_RTC_SLOTS
+#define HESTIA_TEMPO_RTC_SLOTS 8
+#endif
+
+/**
+ * @brief Minimal build profile.
+ *
+ * @details
+ * Defining HESTIA_TEMPO_MINIMAL (for every translation unit) leaves only the
+ * integer timer core: the `const char*` duration overloads, RateLimit, the
+ * formatting and Print layers and the error bookkeeping behind lastError()
+ * are compiled out, along with the per-slot parse cache. The `_hms`
+ * literal still works: it is evaluated at compile time.
+ */
+
+#if defined(ARDUINO)
+class Print;
+#endif
+
 namespace Tempo {
 
   /**
@@ -57,6 +214,193 @@ namespace Tempo {
    */
   using Id = uint32_t;
 
+  /**
+   * @brief Engine time unit (see HESTIA_TEMPO_TIMEBASE_US).
+   */
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+  using Tick = uint64_t;
+  static constexpr Tick TICKS_PER_MS = 1000;
+#else
+  using Tick = uint32_t;
+  static constexpr Tick TICKS_PER_MS = 1;
+#endif
+
+  // ============================================================================
+  // Clock policies (see HESTIA_TEMPO_CLOCK)
+  // ============================================================================
+  /**
+   * @brief Stock time sources. Each returns engine ticks.
+   *
+   * @details
+   * `simulated` marks clocks that do not follow real time; Tempo::idle()
+   * advances them instead of sleeping.
+   */
+  namespace clocks {
+    /** millis() (wraps after ~49 days, also under the µs time base). */
+    struct Millis   { static constexpr bool simulated = false; static Tick now(); };
+
+    /** micros(), extended to 64 bits (query at least every ~71 minutes). */
+    struct Micros   { static constexpr bool simulated = false; static Tick now(); };
+
+    /** ESP32 64-bit esp_timer. */
+    struct EspTimer { static constexpr bool simulated = false; static Tick now(); };
+
+    /** Tempo::VirtualClock. */
+    struct Virtual  { static constexpr bool simulated = true;  static Tick now(); };
+
+    /** Application-provided: define Tempo::clocks::Custom::now(). */
+    struct Custom   { static constexpr bool simulated = false; static Tick now(); };
+  }
+
+  /**
+   * @brief The clock policy selected by HESTIA_TEMPO_CLOCK.
+   */
+  using Clock = clocks::HESTIA_TEMPO_CLOCK;
+
+  // ============================================================================
+  // Virtual clock
+  // ============================================================================
+  /**
+   * @brief Manually advanced engine clock, for host tests and simulation.
+   *
+   * @details
+   * Starts at 0 and only moves when told to. Values are engine ticks
+   * (milliseconds, or microseconds with HESTIA_TEMPO_TIMEBASE_US). The
+   * engine reads it when HESTIA_TEMPO_CLOCK is Virtual.
+   */
+  namespace VirtualClock {
+    /** Current virtual time (ticks). */
+    Tick now();
+
+    /** Jump to an absolute time (ticks). */
+    void set(Tick t);
+
+    /** Move forward by `dt` ticks. */
+    void advance(Tick dt);
+
+    /** Move forward by `ms` milliseconds. */
+    inline void advanceMs(uint32_t ms) { advance((Tick)ms * TICKS_PER_MS); }
+  }
+
+  // ============================================================================
+  // Duration parsing (constexpr)
+  // ============================================================================
+  namespace detail {
+
+    constexpr bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+    /**
+     * @brief Read a run of decimal digits starting at `i`.
+     *
+     * @return Number of digits read (0 if none). `value` saturates above
+     *         uint32_t so overflow is still detected by the caller.
+     */
+    constexpr size_t scanDigits(const char* s, size_t n, size_t i, uint64_t& value) {
+      size_t k = 0;
+      value = 0;
+      while (i + k < n && isDigit(s[i + k])) {
+        if (value <= 0xFFFFFFFFull) value = value * 10 + (uint64_t)(s[i + k] - '0');
+        ++k;
+      }
+      return k;
+    }
+
+    /**
+     * @brief Parse a duration string into milliseconds.
+     *
+     * @param s       Input characters.
+     * @param n       Maximum length; parsing also stops at a NUL character.
+     * @param out_ms  Parsed duration (written on success only).
+     * @param strict  Accept only "HH:MM:SS" (HestiaTempoFormat::parseHMS).
+     * @return true if the whole input is a valid duration.
+     *
+     * @details
+     * Accepted forms (strict = false):
+     *  - "HH:MM:SS" and "HH:MM:SS.mmm" (1 to 3 fraction digits)
+     *  - a decimal number followed by a unit: "250ms", "1.5s", "2m", "1h"
+     *
+     * MM and SS must be two digits in [0..59]. Fractions below the
+     * millisecond are truncated. Results above uint32_t are rejected.
+     * No allocation, no locale, usable in constant expressions.
+     */
+    constexpr bool parseDuration(const char* s, size_t n, uint32_t& out_ms,
+                                 bool strict = false) {
+      if (!s) return false;
+
+      size_t len = 0;
+      while (len < n && s[len] != '\0') ++len;
+
+      uint64_t whole = 0;
+      size_t   i     = scanDigits(s, len, 0, whole);
+      if (i == 0) return false;
+
+      uint64_t ms = 0;
+
+      if (i < len && s[i] == ':') {
+        uint64_t mm = 0;
+        uint64_t ss = 0;
+        if (scanDigits(s, len, i + 1, mm) != 2 || i + 3 >= len || s[i + 3] != ':') return false;
+        if (scanDigits(s, len, i + 4, ss) != 2) return false;
+        if (mm > 59 || ss > 59) return false;
+        i += 6;
+
+        ms = whole * 3600000ull + mm * 60000ull + ss * 1000ull;
+
+        if (i < len && s[i] == '.' && !strict) {
+          uint64_t frac = 0;
+          const size_t k = scanDigits(s, len, i + 1, frac);
+          if (k == 0 || k > 3) return false;
+          for (size_t d = k; d < 3; ++d) frac *= 10;
+          ms += frac;
+          i  += 1 + k;
+        }
+      } else {
+        if (strict) return false;
+
+        // Optional fraction, kept as num / den
+        uint64_t num = 0;
+        uint64_t den = 1;
+        if (i < len && s[i] == '.') {
+          ++i;
+          if (i >= len || !isDigit(s[i])) return false;
+          while (i < len && isDigit(s[i])) {
+            if (den < 1000000ull) {
+              num = num * 10 + (uint64_t)(s[i] - '0');
+              den *= 10;
+            }
+            ++i;
+          }
+        }
+
+        uint64_t unit = 0;
+        if (i + 1 < len && s[i] == 'm' && s[i + 1] == 's') { unit = 1;       i += 2; }
+        else if (i < len && s[i] == 's')                    { unit = 1000;    i += 1; }
+        else if (i < len && s[i] == 'm')                    { unit = 60000;   i += 1; }
+        else if (i < len && s[i] == 'h')                    { unit = 3600000; i += 1; }
+        else return false;
+
+        ms = whole * unit + num * unit / den;
+      }
+
+      if (i != len || whole > 0xFFFFFFFFull || ms > 0xFFFFFFFFull) return false;
+
+      out_ms = (uint32_t)ms;
+      return true;
+    }
+
+    /**
+     * @brief Called for a malformed "_hms" literal.
+     *
+     * @details
+     * Not constexpr: in a constant expression a malformed literal is a
+     * compile error. At run time it records Error::InvalidFormat and
+     * yields 0xFFFFFFFF (NO_DEADLINE), so a timer started from it never
+     * fires instead of firing on every call.
+     */
+    uint32_t invalidDuration();
+
+  } // namespace detail
+
   // ============================================================================
   // Compile-time ID generation (FNV-1a)
   // ============================================================================
@@ -90,182 +434,2013 @@ namespace Tempo {
       return fnv1a(str, len);
     }
 
+    /**
+     * @brief User-defined literal for a duration, in milliseconds.
+     *
+     * Accepts the forms of detail::parseDuration():
+     * @code
+     * constexpr uint32_t TIMEOUT = "00:00:05"_hms;   // 5000
+     * constexpr uint32_t DEBOUNCE = "250ms"_hms;     // 250
+     * @endcode
+     *
+     * A malformed literal fails to compile only where the value is
+     * constant-evaluated (a constexpr variable, a template argument). In an
+     * ordinary call such as `every("1:2"_hms)` it compiles, records
+     * Error::InvalidFormat at run time and yields NO_DEADLINE (~49 days).
+     * Bind durations to a constexpr constant to get the compile-time check.
+     */
+    constexpr uint32_t operator"" _hms(const char* str, size_t len) {
+      uint32_t ms = 0;
+      return detail::parseDuration(str, len, ms) ? ms : detail::invalidDuration();
+    }
+
   } // namespace literals
 
   /**
-   * @brief Optional convenience import for `_id` literal.
+   * @brief Timer expiry handler dispatched by Tempo::poll().
    *
-   * Users may alternatively import it explicitly:
-   * @code
-   * using Tempo::literals::operator"" _id;
-   * @endcode
+   * @param id  Identifier of the expired timer.
+   * @param ctx Context pointer given at registration.
    */
-  using namespace literals;
+  using Handler = void (*)(Id id, void* ctx);
+
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+  /**
+   * @brief Where a handler runs (hardware-timer backend).
+   */
+  enum class Dispatch : uint8_t {
+    /** From Tempo::poll() in the caller's task (default). */
+    Poll,
+
+    /**
+     * Directly from the esp_timer task, as soon as the timer expires.
+     * The handler then runs concurrently with loop(): keep it short and
+     * only touch state that is safe to share between tasks.
+     */
+    Timer
+  };
+#endif
 
   // ============================================================================
-  // Time formatting policy (public API)
+  // Engine storage (internal)
   // ============================================================================
+
   /**
-   * @brief Output formatting policy for elapsed / remaining durations.
+   * @brief Timer kind.
+   *
+   * @note
+   * A slot is permanently associated with its kind (Interval, OneShot or
+   * RateLimit) once allocated.
    */
-  enum class Format : uint8_t {
-    /** HH:MM:SS.mmm (e.g. "00:00:03.512") */
-    HMS_MS,
+  enum class Kind : uint8_t {
+    None,
+    Interval,
+    OneShot,
+    RateLimit ///< Token bucket
+  };
 
-    /** HH:MM:SS */
-    HMS,
+#if defined(HESTIA_TEMPO_STATS)
+  /**
+   * @brief Lateness statistics of one timer (HESTIA_TEMPO_STATS).
+   *
+   * @details
+   * Lateness is the delay between an expiry's ideal deadline and the call
+   * that reported it (every(), poll()), in engine ticks (milliseconds, or
+   * microseconds with HESTIA_TEMPO_TIMEBASE_US), saturated to uint32_t.
+   *
+   * Histogram bucket b counts lateness below 2^b ms (bucket 0: under 1 ms,
+   * bucket 1: 1 ms, bucket 2: 2-3 ms, ...); the last bucket is open-ended.
+   */
+  struct Stats {
+    static constexpr size_t BUCKETS = 8;
 
-    /** Raw milliseconds (implementation-defined textual form) */
-    MS,
+    uint32_t count   = 0;           ///< Expiries recorded
+    uint32_t minLate = 0xFFFFFFFF;  ///< Smallest lateness (ticks)
+    uint32_t maxLate = 0;           ///< Largest lateness (ticks)
+    uint64_t sumLate = 0;           ///< Sum of lateness (ticks)
+    uint16_t histogram[BUCKETS] = {}; ///< Saturating bucket counts
 
-    /** Human-friendly short format ("123 ms", "5 sec", "2 min") */
-    AUTO_SHORT
+    /** Mean lateness (ticks), 0 if nothing was recorded. */
+    uint32_t meanLate() const { return count ? (uint32_t)(sumLate / count) : 0; }
   };
+#endif
 
   /**
- * @brief Tempo runtime error codes.
- *
- * @details
- * Tempo uses a lightweight, non-intrusive error reporting mechanism.
- * Errors are recorded internally and can be queried by the application.
- *
- * Characteristics:
- *  - Errors are non-fatal
- *  - No logging is performed by the library
- *  - No exceptions are used
- *  - The last error overwrites any previous one
- *
- * If the application never queries the error state, Tempo behaves silently.
- */
-enum class Error : uint8_t {
-  /** No error occurred. */
-  None = 0,
-
-  /** Internal slot table is full (MAX_SLOTS exceeded). */
-  SlotTableFull,
+   * @brief Placement of an Interval's first deadline.
+   */
+  enum class Phase : uint8_t {
+    /** First expiry one full period after the first every() (default). */
+    Aligned,
 
-  /** Invalid time format (e.g. malformed "HH:MM:SS"). */
-  InvalidFormat,
+    /**
+     * First expiry at an Id-derived offset within the first period, so
+     * intervals started together with the same period do not all fire in
+     * the same loop iteration. Later periods stay drift-resistant.
+     */
+    Spread
+  };
 
   /**
-   * A timer Id was reused with a different timer kind
-   * (Interval vs OneShot).
-   *
-   * @warning
-   * This condition indicates a programming error.
-   * Behavior is undefined if ignored.
+   * @brief How an Interval catches up after missing several periods.
    */
-  IdKindMismatch
-};
+  enum class CatchUp : uint8_t {
+    /** Fire once per missed period, back-to-back (default). */
+    Burst,
 
-/**
- * @brief Return the last Tempo error.
- *
- * @return Last recorded error code.
- *
- * @note
- * Calling this function does not clear the error.
- * The error state is overwritten on the next error occurrence.
- */
-Error lastError();
+    /** Fire once and jump to the latest boundary, keeping the phase. */
+    Skip,
 
+    /** Fire once and restart the period from now (phase is reset). */
+    Coalesce
+  };
 
-  // ============================================================================
-  // Interval timer
-  // ============================================================================
   /**
-   * @brief Periodic non-blocking timer.
+   * @brief Internal timer slot.
    *
    * @details
-   * `every()` returns true exactly once per period and automatically rearms.
-   * If the call is late, the timer realigns to the next expected boundary
-   * (drift-resistant behavior).
+   * Each slot represents one logical timer identified by a Tempo::Id.
+   * Slots are allocated lazily on first use and stay allocated until the
+   * timer is explicitly released (or auto-released, see Release::OnDone).
+   *
+   * A slot holds only what queries read: 16 bytes on 32-bit targets with
+   * the default options (timestamps, Id, flags; no padding, the flags share
+   * one byte with the catch-up policy). Handler registration and the parse
+   * cache live in a parallel SlotExtra array of the pool, and pools keep a
+   * dense copy of the Ids (see SlotPool), so lookups do not pull slots into
+   * the cache either. Opt-in instrumentation (HESTIA_TEMPO_STATS) and the
+   * esp_timer backend add their fields here.
+   *
+   * @note
+   * Exposed only so that static storage can be declared in headers.
+   * Applications must not access slot fields directly. Writes to the flag
+   * byte are serialized like the timestamps (SlotWriter).
    */
-  class Interval {
-  public:
-    /**
-     * @brief Construct an Interval facade bound to a timer Id.
-     */
-    explicit Interval(Id id);
+  struct SlotExtra;
 
-    /**
-     * @brief Check whether the interval has expired.
-     *
-     * @param period_ms Interval duration in milliseconds.
-     * @return true if the interval just expired, false otherwise.
-     */
-    bool every(uint32_t period_ms);
+  struct Slot {
+    Tick     start   = 0;   ///< Start timestamp (ticks), free-list link when released
+                            ///< (RateLimit: last refill)
+    union {                 // keyed on kind
+      Tick   period  = 0;   ///< Interval / OneShot: duration or interval (ticks)
+      Tick   tokens;        ///< RateLimit: bucket content (fixed-point tokens)
+    };
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    uint32_t seq     = 0;   ///< Sequence counter (odd while being written)
+#endif
+    Id       id      = 0;
+    uint16_t overruns = 0;  ///< Periods missed at the last expiry (saturating)
+    Kind     kind    = Kind::None;
+    bool     active  : 1;
+    bool     release : 1;   ///< Release the slot once done() reports expiry
+    bool     consumed : 1;  ///< OneShot expiry claimed by poll(); restart() re-arms
+    uint8_t  catchUp : 2;   ///< Interval catch-up policy (CatchUp)
+#if defined(HESTIA_TEMPO_STATS)
+    Stats    stats;         ///< Lateness statistics
+#endif
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+    void*    timer   = nullptr; ///< esp_timer_handle_t, created on first use
+    SlotExtra* extra = nullptr; ///< Cold data of the slot (pool slots only)
+    uint16_t fired   = 0;   ///< Expiries signalled by the timer, not yet consumed
+    bool     direct  = false; ///< Handler dispatched from the esp_timer task
+    bool     rephase = false; ///< First expiry is a shortened (spread) period
+#endif
 
-    /**
-     * @brief Same as every(uint32_t) but accepts a "HH:MM:SS" string.
-     */
-    bool every(const char* hms);
+    constexpr Slot()
+      : active(false), release(false), consumed(false), catchUp((uint8_t)CatchUp::Burst) {}
+    constexpr Slot(Id i, Kind k) : Slot() { id = i; kind = k; }
+  };
 
-  private:
-    Id _id;
+  /**
+   * @brief Last duration string parsed for a slot, and its value.
+   *
+   * @details
+   * Keyed by the string's address (see Interval::every(const char*)).
+   * Pools keep it in SlotExtra; Registry and TimerArray, which have no
+   * SlotExtra, keep one per slot next to their slots.
+   */
+  struct ParseCache {
+    const char* src = nullptr;  ///< Last duration string parsed
+    uint32_t    ms  = 0;        ///< Parsed value of `src` (ms)
   };
 
-  // ============================================================================
-  // One-shot timer
-  // ============================================================================
   /**
-   * @brief Single-shot non-blocking timer.
+   * @brief Cold per-slot data: handler registration and parse cache.
    *
    * @details
-   * Typical use cases: delays, watchdogs, timeouts, deferred actions.
+   * Kept by pools in an array parallel to their slots and only touched on
+   * registration, dispatch and string parsing. A RateLimit slot has no
+   * parse cache and keeps its refill rate in the same storage.
    */
-  class OneShot {
-  public:
-    /**
-     * @brief Construct a OneShot facade bound to a timer Id.
-     */
-    explicit OneShot(Id id);
+  struct SlotExtra {
+    Handler  handler = nullptr; ///< Dispatched by poll() on expiry
+    void*    ctx     = nullptr; ///< Handler context
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    union {                     // keyed on the slot's kind
+      ParseCache cache = {};    ///< Interval / OneShot: duration string cache
+      uint32_t   rate;          ///< RateLimit: refill rate (tokens/s)
+    };
+#endif
+  };
+
+  /**
+   * @brief Slot reclamation policy for OneShot timers.
+   */
+  enum class Release : uint8_t {
+    /** Keep the slot allocated after expiry (default). */
+    Keep,
 
     /**
-     * @brief Start the timer with a duration in milliseconds.
+     * Release the slot the first time done() reports expiry.
+     * Intended for short-lived timers with runtime-derived Ids.
      */
-    void start(uint32_t duration_ms);
+    OnDone
+  };
+
+  class IntervalHandle;
+  class OneShotHandle;
+  class SlotPool;
+
+  /**
+   * @brief Value returned by nextDeadline() when no timer is pending.
+   */
+  static constexpr uint32_t NO_DEADLINE = 0xFFFFFFFFu;
+
+  namespace detail {
 
     /**
-     * @brief Start the timer using a strict "HH:MM:SS" duration string.
+     * @brief Milliseconds until the earliest pending deadline of a slot array.
+     *
+     * @param pos Receives the position of that slot (n if none).
+     * @return Remaining time, or NO_DEADLINE.
      */
-    void start(const char* hms);
+    uint32_t earliestDeadline(const Slot* slots, size_t n, Tick now, size_t& pos);
 
     /**
-     * @brief Restart the timer using the previously configured duration.
+     * @brief Current engine time (ticks).
      */
-    void restart();
+    Tick now();
+
+  } // namespace detail
+
+  // ============================================================================
+  // Compile-time timer registry
+  // ============================================================================
+
+  /**
+   * @brief Registry declaration of an Interval timer.
+   */
+  template <Id ID>
+  struct IntervalTimer {
+    static constexpr Id   id   = ID;
+    static constexpr Kind kind = Kind::Interval;
+  };
+
+  /**
+   * @brief Registry declaration of a OneShot timer.
+   */
+  template <Id ID>
+  struct OneShotTimer {
+    static constexpr Id   id   = ID;
+    static constexpr Kind kind = Kind::OneShot;
+  };
+
+  namespace detail {
+
+    /**
+     * @brief Position of an Id in a declaration list (N if absent).
+     */
+    template <Id ID, typename... Timers>
+    constexpr size_t registryIndex() {
+      constexpr Id ids[] = { Timers::id... };
+      for (size_t i = 0; i < sizeof...(Timers); ++i) {
+        if (ids[i] == ID) return i;
+      }
+      return sizeof...(Timers);
+    }
+
+    /**
+     * @brief Declared kind of an Id (Kind::None if absent).
+     */
+    template <Id ID, typename... Timers>
+    constexpr Kind registryKind() {
+      constexpr Kind kinds[] = { Timers::kind... };
+      constexpr size_t i = registryIndex<ID, Timers...>();
+      return i < sizeof...(Timers) ? kinds[i] : Kind::None;
+    }
+
+    /**
+     * @brief True if two declarations share an Id with different kinds.
+     */
+    template <typename... Timers>
+    constexpr bool registryKindConflict() {
+      constexpr Id   ids[]   = { Timers::id... };
+      constexpr Kind kinds[] = { Timers::kind... };
+      for (size_t i = 0; i < sizeof...(Timers); ++i) {
+        for (size_t j = i + 1; j < sizeof...(Timers); ++j) {
+          if (ids[i] == ids[j] && kinds[i] != kinds[j]) return true;
+        }
+      }
+      return false;
+    }
+
+    /**
+     * @brief True if two declarations share an Id with the same kind.
+     */
+    template <typename... Timers>
+    constexpr bool registryDuplicate() {
+      constexpr Id   ids[]   = { Timers::id... };
+      constexpr Kind kinds[] = { Timers::kind... };
+      for (size_t i = 0; i < sizeof...(Timers); ++i) {
+        for (size_t j = i + 1; j < sizeof...(Timers); ++j) {
+          if (ids[i] == ids[j] && kinds[i] == kinds[j]) return true;
+        }
+      }
+      return false;
+    }
+
+  } // namespace detail
+
+  /**
+   * @brief Compile-time table of timers with static slot indices.
+   *
+   * @details
+   * Each declared timer owns a statically allocated slot whose index is
+   * fixed at compile time, so accessing it involves no runtime lookup.
+   *
+   * Declaration errors are rejected by static_assert:
+   *  - Two entries with the same Id and kind (repeated declaration, or two
+   *    names whose FNV-1a hashes collide)
+   *  - Two entries with the same Id and different kinds (the compile-time
+   *    equivalent of Error::IdKindMismatch)
+   *  - Accessing an undeclared Id, or accessing an Id with the wrong kind
+   *
+   * Example:
+   * @code
+   * using AppTimers = Tempo::Registry<
+   *   Tempo::IntervalTimer<"HEARTBEAT"_id>,
+   *   Tempo::OneShotTimer<"WATCHDOG"_id>
+   * >;
+   *
+   * if (AppTimers::interval<"HEARTBEAT"_id>().every(1000)) { ... }
+   * AppTimers::oneShot<"WATCHDOG"_id>().start(5000);
+   * @endcode
+   *
+   * @note
+   * Registry timers are independent from the runtime slot table:
+   * `Tempo::interval("HEARTBEAT"_id)` does not address the registry slot.
+   */
+  template <typename... Timers>
+  class Registry {
+  public:
+    static_assert(sizeof...(Timers) > 0, "Registry must declare at least one timer");
+    static_assert(!detail::registryKindConflict<Timers...>(),
+                  "Registry: same Id declared as both Interval and OneShot");
+    static_assert(!detail::registryDuplicate<Timers...>(),
+                  "Registry: duplicate Id (repeated declaration or FNV-1a collision)");
+
+    /**
+     * @brief Number of declared timers.
+     */
+    static constexpr size_t size = sizeof...(Timers);
+
+    /**
+     * @brief Compile-time slot index of a declared Id.
+     */
+    template <Id ID>
+    static constexpr size_t indexOf() {
+      constexpr size_t i = detail::registryIndex<ID, Timers...>();
+      static_assert(i < size, "Registry: Id is not declared");
+      return i;
+    }
+
+    /**
+     * @brief Handle to a declared Interval (no lookup).
+     */
+    template <Id ID>
+    static IntervalHandle interval();
+
+    /**
+     * @brief Handle to a declared OneShot (no lookup).
+     */
+    template <Id ID>
+    static OneShotHandle oneShot();
+
+    /**
+     * @brief Milliseconds until the earliest pending registry timer expires.
+     *
+     * @details
+     * Registry timers are not covered by Tempo::nextDeadline(). The registry
+     * is small and fixed, so this is a single pass over its slots.
+     */
+    static uint32_t nextDeadline() {
+      size_t pos;
+      return detail::earliestDeadline(_slots, size, detail::now(), pos);
+    }
+
+  private:
+    static inline Slot _slots[sizeof...(Timers)] = { Slot{ Timers::id, Timers::kind }... };
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    static inline ParseCache _caches[sizeof...(Timers)] = {};
+
+    static ParseCache* cache(size_t i) { return &_caches[i]; }
+#else
+    static ParseCache* cache(size_t) { return nullptr; }
+#endif
+  };
+
+  /**
+   * @brief Optional convenience import for `_id` literal.
+   *
+   * Users may alternatively import it explicitly:
+   * @code
+   * using Tempo::literals::operator"" _id;
+   * @endcode
+   */
+  using namespace literals;
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  // ============================================================================
+  // Time formatting policy (public API)
+  // ============================================================================
+  /**
+   * @brief Output formatting policy for elapsed / remaining durations.
+   */
+  enum class Format : uint8_t {
+    /** HH:MM:SS.mmm (e.g. "00:00:03.512") */
+    HMS_MS,
+
+    /** HH:MM:SS */
+    HMS,
+
+    /** Raw milliseconds ("3512") */
+    MS,
+
+    /** Human-friendly short format ("123 ms", "5 sec", "2 min") */
+    AUTO_SHORT
+  };
+
+  /**
+   * @brief Buffer size sufficient for any Format of any uint32_t duration
+   *        ("1193:02:47.295" plus terminator).
+   */
+  static constexpr size_t FORMAT_BUFFER_SIZE = 16;
+#endif
+
+  /**
+ * @brief Tempo runtime error codes.
+ *
+ * @details
+ * Tempo uses a lightweight, non-intrusive error reporting mechanism.
+ * Errors are recorded internally and can be queried by the application.
+ *
+ * Characteristics:
+ *  - Errors are non-fatal
+ *  - No logging is performed by the library
+ *  - No exceptions are used
+ *  - The last error overwrites any previous one
+ *
+ * If the application never queries the error state, Tempo behaves silently.
+ */
+enum class Error : uint8_t {
+  /** No error occurred. */
+  None = 0,
+
+  /** A slot pool is full (pool capacity exceeded). */
+  SlotTableFull,
+
+  /** Invalid time format (e.g. malformed "HH:MM:SS" or "1.5s"). */
+  InvalidFormat,
+
+  /**
+   * A timer Id was reused with a different timer kind
+   * (Interval vs OneShot).
+   *
+   * @warning
+   * This condition indicates a programming error.
+   * Behavior is undefined if ignored.
+   */
+  IdKindMismatch
+};
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+/**
+ * @brief Return the last Tempo error.
+ *
+ * @return Last recorded error code.
+ *
+ * @note
+ * Calling this function does not clear the error.
+ * The error state is overwritten on the next error occurrence.
+ */
+Error lastError();
+#endif
+
+
+  // ============================================================================
+  // Interval timer
+  // ============================================================================
+  /**
+   * @brief Periodic non-blocking timer.
+   *
+   * @details
+   * `every()` returns true exactly once per period and automatically rearms.
+   * If the call is late, the timer realigns to the next expected boundary
+   * (drift-resistant behavior). See CatchUp for calls late by several
+   * periods.
+   */
+  class Interval {
+  public:
+    /**
+     * @brief Construct an Interval facade bound to a timer Id.
+     */
+    explicit Interval(Id id);
+
+    /**
+     * @brief Construct an Interval facade bound to a timer Id in a given pool.
+     */
+    Interval(SlotPool& pool, Id id);
+
+    /**
+     * @brief Check whether the interval has expired.
+     *
+     * @param period_ms Interval duration in milliseconds.
+     * @return true if the interval just expired, false otherwise.
+     */
+    bool every(uint32_t period_ms);
+
+    /**
+     * @brief Same as every(uint32_t), choosing where the first deadline
+     *        falls (only used by the call that starts the interval).
+     *
+     * @code
+     * if (Tempo::interval("SENSOR"_id).every(1000, Tempo::Phase::Spread)) { ... }
+     * @endcode
+     */
+    bool every(uint32_t period_ms, Phase phase);
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    /**
+     * @brief Same as every(uint32_t) but accepts a duration string
+     *        ("HH:MM:SS[.mmm]", "250ms", "1.5s", "2m", "1h").
+     *
+     * The parse is cached per slot, keyed by the string's address, so
+     * repeated calls with the same literal cost the same as the integer
+     * form. Do not reuse one buffer for different contents.
+     */
+    bool every(const char* hms);
+#endif
+
+    /**
+     * @brief Stop the interval and return its slot to the pool.
+     */
+    void release();
+
+    /**
+     * @brief Time before the next expiry, in milliseconds.
+     *
+     * @return 0 if the interval is inactive or already overdue.
+     */
+    uint32_t remaining() const;
+
+    /**
+     * @brief Register a handler called by Tempo::poll() once per period.
+     *
+     * @details
+     * Starts the interval if needed (an active interval keeps its phase and
+     * adopts the new period). The handler stays registered until release().
+     */
+    void onEvery(uint32_t period_ms, Handler fn, void* ctx = nullptr);
+
+    /**
+     * @brief Select how the interval catches up after a stall.
+     *
+     * @details
+     * Applies to every(), the cached handles and poll(). The policy is kept
+     * until release().
+     */
+    void catchUp(CatchUp policy);
+
+    /**
+     * @brief Periods missed at the last expiry.
+     *
+     * @details
+     * 0 when the expiry was on time. After a stall of N periods this is
+     * N - 1: with CatchUp::Burst that many expiries are still pending, with
+     * Skip / Coalesce they were dropped and can be handled in one batch.
+     */
+    uint32_t overruns() const;
+
+#if defined(HESTIA_TEMPO_STATS)
+    /**
+     * @brief Lateness statistics of this interval (empty if unknown).
+     */
+    Stats stats() const;
+#endif
+
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+    /**
+     * @brief Same as onEvery(), choosing where the handler runs.
+     */
+    void onEvery(uint32_t period_ms, Handler fn, void* ctx, Dispatch dispatch);
+#endif
+
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+    /**
+     * @brief Same as every(uint32_t) with a period in microseconds.
+     */
+    bool every_us(Tick period_us);
+
+    /**
+     * @brief Same as remaining(), in microseconds.
+     */
+    Tick remaining_us() const;
+#endif
+
+  private:
+    SlotPool* _pool;
+    Id        _id;
+  };
+
+  // ============================================================================
+  // One-shot timer
+  // ============================================================================
+  /**
+   * @brief Single-shot non-blocking timer.
+   *
+   * @details
+   * Typical use cases: delays, watchdogs, timeouts, deferred actions.
+   */
+  class OneShot {
+  public:
+    /**
+     * @brief Construct a OneShot facade bound to a timer Id.
+     */
+    explicit OneShot(Id id);
+
+    /**
+     * @brief Construct a OneShot facade bound to a timer Id in a given pool.
+     */
+    OneShot(SlotPool& pool, Id id);
+
+    /**
+     * @brief Start the timer with a duration in milliseconds.
+     */
+    void start(uint32_t duration_ms);
+
+    /**
+     * @brief Start the timer with a duration and a slot reclamation policy.
+     *
+     * @details
+     * With Release::OnDone the slot is returned to the pool the first time
+     * done() reports expiry; subsequent queries behave as for an inactive
+     * timer.
+     */
+    void start(uint32_t duration_ms, Release release);
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    /**
+     * @brief Start the timer using a duration string
+     *        ("HH:MM:SS[.mmm]", "250ms", "1.5s", "2m", "1h").
+     *
+     * The parse is cached per slot, keyed by the string's address, so
+     * repeated calls with the same literal cost the same as the integer
+     * form. Do not reuse one buffer for different contents.
+     */
+    void start(const char* hms);
+#endif
+
+    /**
+     * @brief Restart the timer using the previously configured duration.
+     *
+     * @details
+     * No effect on a timer that was never started or was cancelled. A timer
+     * whose expiry was consumed by Tempo::poll() can be restarted.
+     */
+    void restart();
+
+    /**
+     * @brief Cancel the timer.
+     *
+     * @note
+     * The slot stays allocated; use release() to return it to the pool.
+     */
+    void cancel();
+
+    /**
+     * @brief Cancel the timer and return its slot to the pool.
+     */
+    void release();
+
+    /**
+     * @brief Check whether the timer is currently running.
+     */
+    bool running() const;
+
+    /**
+     * @brief Check whether the timer has expired.
+     */
+    bool done() const;
+
+    /**
+     * @brief Elapsed time since start, in milliseconds.
+     */
+    uint32_t elapsed() const;
+
+    /**
+     * @brief Remaining time before expiration, in milliseconds.
+     */
+    uint32_t remaining() const;
+
+    /**
+     * @brief Register a handler called by Tempo::poll() when the timer expires.
+     *
+     * @details
+     * Registration does not start the timer. Each start() / restart() fires
+     * the handler once: poll() consumes the expiry (done() then reports false,
+     * and a Release::OnDone timer is released). The handler stays registered
+     * until release().
+     */
+    void onDone(Handler fn, void* ctx = nullptr);
+
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+    /**
+     * @brief Same as onDone(), choosing where the handler runs.
+     */
+    void onDone(Handler fn, void* ctx, Dispatch dispatch);
+#endif
+
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+    /**
+     * @brief Start the timer with a duration in microseconds.
+     *
+     * @note
+     * The 64-bit duration also allows timers longer than ~49.7 days.
+     */
+    void start_us(Tick duration_us);
+
+    /**
+     * @brief Elapsed time since start, in microseconds.
+     */
+    Tick elapsed_us() const;
+
+    /**
+     * @brief Remaining time before expiration, in microseconds.
+     */
+    Tick remaining_us() const;
+#endif
+
+  private:
+    SlotPool* _pool;
+    Id        _id;
+  };
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  // ============================================================================
+  // Rate limiter
+  // ============================================================================
+  /**
+   * @brief Token-bucket rate limiter.
+   *
+   * @details
+   * The bucket holds up to `burst` tokens and refills at `rate` tokens per
+   * second; each allow() that returns true takes one token. Refill is
+   * computed lazily from the time elapsed since the previous call, in
+   * exact integer arithmetic (no drift, no rounding loss), so an idle
+   * limiter costs nothing.
+   * @code
+   * if (Tempo::rateLimit("PUB"_id).allow(5, 20)) {
+   *   mqtt.publish(topic, payload);   // at most 5/s, bursts of 20
+   * }
+   * @endcode
+   *
+   * A new limiter starts full. Rate and burst are given on every call, like
+   * an Interval period, and may change at any time.
+   *
+   * The bucket lives in a regular slot: it counts against the pool and
+   * reports Error::IdKindMismatch if its Id is also used by a timer.
+   */
+  class RateLimit {
+  public:
+    /**
+     * @brief Construct a RateLimit facade bound to an Id.
+     */
+    explicit RateLimit(Id id);
+
+    /**
+     * @brief Construct a RateLimit facade bound to an Id in a given pool.
+     */
+    RateLimit(SlotPool& pool, Id id);
+
+    /**
+     * @brief Take one token if available.
+     *
+     * @param rate  Refill rate, in tokens per second.
+     * @param burst Bucket capacity, in tokens.
+     * @return true if a token was taken; false if the bucket is empty (or
+     *         the pool is full).
+     */
+    bool allow(uint32_t rate, uint32_t burst);
+
+    /**
+     * @brief Milliseconds until the next token is available.
+     *
+     * @return 0 if allow() would succeed now, NO_DEADLINE if the rate is 0.
+     */
+    uint32_t nextToken() const;
+
+    /**
+     * @brief Refill the bucket (the next allow() finds it full).
+     */
+    void reset();
+
+    /**
+     * @brief Return the limiter's slot to the pool.
+     */
+    void release();
+
+  private:
+    SlotPool* _pool;
+    Id        _id;
+  };
+#endif
+
+  // ============================================================================
+  // Cached timer handles
+  // ============================================================================
+
+  /**
+   * @brief Interval bound to its internal slot.
+   *
+   * @details
+   * Unlike the Interval facade, a handle resolves its slot once and keeps a
+   * direct reference to it, so repeated calls skip the Id lookup entirely.
+   * Handles are meant to be stored (globals, members) and reused in hot loops.
+   *
+   * If the slot table was full when the handle was bound, binding is retried
+   * on the next call. A handle whose slot was released rebinds transparently.
+   */
+  class IntervalHandle {
+  public:
+    /**
+     * @brief Bind a handle to the Interval identified by Id.
+     */
+    explicit IntervalHandle(Id id);
+
+    /**
+     * @brief Bind a handle to the Interval identified by Id in a given pool.
+     */
+    IntervalHandle(SlotPool& pool, Id id);
+
+    /**
+     * @brief Same as Interval::every(uint32_t).
+     */
+    bool every(uint32_t period_ms);
+
+    /**
+     * @brief Same as Interval::every(uint32_t, Phase).
+     */
+    bool every(uint32_t period_ms, Phase phase);
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    /**
+     * @brief Same as Interval::every(const char*).
+     */
+    bool every(const char* hms);
+#endif
+
+    /**
+     * @brief Same as Interval::release().
+     */
+    void release();
+
+    /**
+     * @brief Same as Interval::remaining().
+     */
+    uint32_t remaining() const;
+
+    /**
+     * @brief Same as Interval::catchUp().
+     */
+    void catchUp(CatchUp policy);
+
+    /**
+     * @brief Same as Interval::overruns().
+     */
+    uint32_t overruns() const;
+
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+    /** @brief Same as Interval::every_us(). */
+    bool every_us(Tick period_us);
+
+    /** @brief Same as Interval::remaining_us(). */
+    Tick remaining_us() const;
+#endif
+
+    /**
+     * @brief Identifier this handle is bound to.
+     */
+    Id id() const { return _id; }
+
+  private:
+    template <typename...> friend class Registry;
+    template <typename, size_t> friend class TimerArray;
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    IntervalHandle(Id id, Slot* slot, ParseCache* cache)
+      : _pool(nullptr), _id(id), _slot(slot), _cache(cache) {}
+#else
+    IntervalHandle(Id id, Slot* slot, ParseCache* = nullptr)
+      : _pool(nullptr), _id(id), _slot(slot) {}
+#endif
+
+    Slot* slot(bool create) const;
+
+    SlotPool*     _pool;
+    Id            _id;
+    mutable Slot* _slot;
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    ParseCache*   _cache = nullptr; ///< Parse cache of pool-less slots
+#endif
+  };
+
+  /**
+   * @brief OneShot bound to its internal slot.
+   *
+   * @details
+   * Same semantics as the OneShot facade, without the per-call Id lookup.
+   * A typical `if (!h.running()) h.start(...)` sequence costs no table scan.
+   */
+  class OneShotHandle {
+  public:
+    /**
+     * @brief Bind a handle to the OneShot identified by Id.
+     */
+    explicit OneShotHandle(Id id);
+
+    /**
+     * @brief Bind a handle to the OneShot identified by Id in a given pool.
+     */
+    OneShotHandle(SlotPool& pool, Id id);
+
+    /** @brief Same as OneShot::start(uint32_t). */
+    void start(uint32_t duration_ms);
+
+    /** @brief Same as OneShot::start(uint32_t, Release). */
+    void start(uint32_t duration_ms, Release release);
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    /**
+     * @brief Same as OneShot::start(const char*).
+     */
+    void start(const char* hms);
+#endif
+
+    /** @brief Same as OneShot::restart(). */
+    void restart();
+
+    /** @brief Same as OneShot::cancel(). */
+    void cancel();
+
+    /** @brief Same as OneShot::release(). */
+    void release();
+
+    /** @brief Same as OneShot::running(). */
+    bool running() const;
+
+    /** @brief Same as OneShot::done(). */
+    bool done() const;
+
+    /** @brief Same as OneShot::elapsed(). */
+    uint32_t elapsed() const;
+
+    /** @brief Same as OneShot::remaining(). */
+    uint32_t remaining() const;
+
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+    /** @brief Same as OneShot::start_us(). */
+    void start_us(Tick duration_us);
+
+    /** @brief Same as OneShot::elapsed_us(). */
+    Tick elapsed_us() const;
+
+    /** @brief Same as OneShot::remaining_us(). */
+    Tick remaining_us() const;
+#endif
+
+    /**
+     * @brief Identifier this handle is bound to.
+     */
+    Id id() const { return _id; }
+
+  private:
+    template <typename...> friend class Registry;
+    template <typename, size_t> friend class TimerArray;
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    OneShotHandle(Id id, Slot* slot, ParseCache* cache)
+      : _pool(nullptr), _id(id), _slot(slot), _cache(cache) {}
+#else
+    OneShotHandle(Id id, Slot* slot, ParseCache* = nullptr)
+      : _pool(nullptr), _id(id), _slot(slot) {}
+#endif
+
+    Slot* slot(bool create) const;
+
+    SlotPool*     _pool;
+    Id            _id;
+    mutable Slot* _slot;
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    ParseCache*   _cache = nullptr; ///< Parse cache of pool-less slots
+#endif
+  };
+
+  /**
+   * @brief Maps a facade type to its cached handle type.
+   */
+  template <typename T> struct HandleOf;
+  template <> struct HandleOf<Interval> {
+    using type = IntervalHandle;
+    static constexpr Kind kind = Kind::Interval;
+  };
+  template <> struct HandleOf<OneShot> {
+    using type = OneShotHandle;
+    static constexpr Kind kind = Kind::OneShot;
+  };
+
+  /**
+   * @brief Bind a cached handle to a timer Id.
+   *
+   * Example:
+   * @code
+   * static Tempo::IntervalHandle hb = Tempo::bind<Tempo::Interval>("HB"_id);
+   *
+   * if (hb.every(1000)) {
+   *     // called every second, no lookup
+   * }
+   * @endcode
+   */
+  template <typename T>
+  typename HandleOf<T>::type bind(Id id) {
+    return typename HandleOf<T>::type(id);
+  }
+
+  // ============================================================================
+  // Timer arrays
+  // ============================================================================
+
+  /**
+   * @brief N timers of one kind addressed by index.
+   *
+   * @details
+   * The array owns a contiguous block of slots, so `arr[i]` is a handle
+   * bound directly to slot i: no Id to invent, no hashing, no lookup and no
+   * collision between members. Member i carries the Id `base + i`, which is
+   * what handlers and diagnostics see.
+   *
+   * Declared through the aliases:
+   * @code
+   * static Tempo::OneShotArray<8> relayTimeout("RELAY"_id);
+   *
+   * relayTimeout[ch].start(500);
+   * if (relayTimeout[ch].done()) { ... }
+   * @endcode
+   *
+   * @note
+   * Like Registry timers, array members are independent from the slot
+   * pools and are not covered by Tempo::nextDeadline(); the array reports
+   * its own.
+   */
+  template <typename T, size_t N>
+  class TimerArray {
+    static_assert(N > 0, "TimerArray must hold at least one timer");
+
+  public:
+    using Handle = typename HandleOf<T>::type;
+
+    /**
+     * @brief Number of members.
+     */
+    static constexpr size_t size = N;
+
+    /**
+     * @brief Declare the array; member i is identified by `base + i`.
+     */
+    explicit constexpr TimerArray(Id base = 0) {
+      for (size_t i = 0; i < N; ++i) {
+        _slots[i].id   = base + (Id)i;
+        _slots[i].kind = HandleOf<T>::kind;
+      }
+    }
+
+    TimerArray(const TimerArray&) = delete;
+    TimerArray& operator=(const TimerArray&) = delete;
+
+    /**
+     * @brief Handle to member `i` (no lookup).
+     *
+     * @pre i < N
+     */
+    Handle operator[](size_t i) { return Handle(_slots[i].id, &_slots[i], cache(i)); }
+
+    /**
+     * @brief Milliseconds until the earliest pending member expires.
+     */
+    uint32_t nextDeadline() const {
+      size_t pos;
+      return detail::earliestDeadline(_slots, N, detail::now(), pos);
+    }
+
+  private:
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    ParseCache* cache(size_t i) { return &_caches[i]; }
+
+    Slot       _slots[N]  = {};
+    ParseCache _caches[N] = {};
+#else
+    ParseCache* cache(size_t) { return nullptr; }
+
+    Slot _slots[N] = {};
+#endif
+  };
+
+  /**
+   * @brief N OneShot timers addressed by index (see TimerArray).
+   */
+  template <size_t N>
+  using OneShotArray = TimerArray<OneShot, N>;
+
+  /**
+   * @brief N Interval timers addressed by index (see TimerArray).
+   */
+  template <size_t N>
+  using IntervalArray = TimerArray<Interval, N>;
+
+  // ============================================================================
+  // Slot pools
+  // ============================================================================
+
+  /**
+   * @brief State of one timer, as reported by Tempo::snapshot().
+   *
+   * @details
+   * Times are in milliseconds, taken at the snapshot's timestamp. For an
+   * Interval, elapsed / remaining refer to the current period. For a
+   * RateLimit, remaining is the wait for the next token.
+   */
+  struct TimerInfo {
+    Id       id;
+    Kind     kind;
+    bool     active;     ///< Started (running or expired), or bucket in use
+    uint32_t elapsed;    ///< Time since start / period boundary (0 if inactive)
+    uint32_t remaining;  ///< Time before expiry (0 if inactive or overdue)
+    uint32_t overruns;   ///< Interval periods missed at the last expiry
+  };
+
+  /**
+   * @brief Runtime slot table with its own hashed lookup index.
+   *
+   * @details
+   * A pool owns a fixed number of slots and an open-addressing index over
+   * them. Pools are fully independent: exhausting one pool never affects
+   * another, and each lookup only probes the index of its own pool.
+   *
+   * Index cells point into a dense array holding a copy of each slot's Id,
+   * so a probe compares 4-byte keys in one contiguous block and only reads
+   * the slot it returns.
+   *
+   * SlotPool is the storage-agnostic part; concrete pools are declared with
+   * Tempo::Pool<N>. The facade entry points (Tempo::interval(), ...) use the
+   * default pool, sized by HESTIA_TEMPO_MAX_SLOTS.
+   */
+  class SlotPool {
+  public:
+    SlotPool(const SlotPool&) = delete;
+    SlotPool& operator=(const SlotPool&) = delete;
+
+    ~SlotPool();
+
+    /**
+     * @brief Obtain an Interval facade for a given Id in this pool.
+     */
+    Interval interval(Id id) { return Interval(*this, id); }
+
+    /**
+     * @brief Obtain a OneShot facade for a given Id in this pool.
+     */
+    OneShot oneShot(Id id) { return OneShot(*this, id); }
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+    /**
+     * @brief Obtain a RateLimit facade for a given Id in this pool.
+     */
+    RateLimit rateLimit(Id id) { return RateLimit(*this, id); }
+#endif
+
+    /**
+     * @brief Bind a cached handle to a timer Id in this pool.
+     */
+    template <typename T>
+    typename HandleOf<T>::type bind(Id id) {
+      return typename HandleOf<T>::type(*this, id);
+    }
+
+    /**
+     * @brief Maximum number of timers in this pool.
+     */
+    size_t capacity() const { return _capacity; }
+
+    /**
+     * @brief Number of slots currently allocated.
+     */
+    size_t used() const { return _count; }
+
+    /**
+     * @brief Engine entry point: look up (and optionally allocate) a slot.
+     *
+     * @note
+     * Used by facades and handles; applications should not need it.
+     */
+    Slot* slot(Id id, Kind expected, bool create = true);
+
+    /**
+     * @brief Engine entry point: return a slot to the pool (O(1)).
+     */
+    void release(Slot* s);
+
+    /**
+     * @brief Engine entry point: cold data of a slot of this pool
+     *        (nullptr if the pool keeps none).
+     */
+    SlotExtra* extra(const Slot* s) const { return _extra ? &_extra[s - _slots] : nullptr; }
+
+    /**
+     * @brief Milliseconds until the earliest pending timer of this pool expires.
+     *
+     * @details
+     * Pending timers are active Intervals and active, not yet expired
+     * OneShots. An overdue Interval yields 0.
+     *
+     * The earliest slot is cached and maintained incrementally by start(),
+     * every() and cancel()/release(); the table is only rescanned after the
+     * cached slot itself moved or expired.
+     *
+     * @return Remaining time, or NO_DEADLINE if nothing is pending.
+     */
+    uint32_t nextDeadline();
+
+    /**
+     * @brief Dispatch handlers of the expired timers of this pool.
+     *
+     * @param now Timestamp used for every timer of the pass.
+     * @return Number of handlers called.
+     */
+    size_t poll(Tick now);
+
+    /**
+     * @brief Engine entry point: a slot deadline was set or moved.
+     */
+    void scheduled(const Slot* s, Tick now);
+
+    /**
+     * @brief Engine entry point: a slot no longer has a deadline.
+     */
+    void unscheduled(const Slot* s);
+
+    /**
+     * @brief Next pool holding at least one allocated slot (internal list).
+     */
+    SlotPool* nextPool() const { return _next; }
+
+    /**
+     * @brief Snapshot visitor: called once per allocated timer.
+     */
+    using SnapshotVisitor = void (*)(const TimerInfo& info, void* ctx);
+
+    /**
+     * @brief Report the state of every allocated timer of this pool.
+     *
+     * @param now Timestamp used for every timer of the pass.
+     * @return Number of timers visited.
+     */
+    size_t snapshot(SnapshotVisitor fn, void* ctx, Tick now) const;
+
+#if defined(HESTIA_TEMPO_STATS)
+    /**
+     * @brief Statistics visitor: called once per allocated timer.
+     */
+    using StatsVisitor = void (*)(Id id, Kind kind, const Stats& stats, void* ctx);
+
+    /**
+     * @brief Visit the statistics of every allocated timer of this pool.
+     *
+     * @return Number of timers visited.
+     */
+    size_t visitStats(StatsVisitor fn, void* ctx = nullptr) const;
+
+    /**
+     * @brief Clear the statistics of every timer of this pool.
+     */
+    void resetStats();
+#endif
+
+  protected:
+    /**
+     * @param extra   Cold data, one entry per slot. May be nullptr only for
+     *                pools that hand out no facade (their slots are not
+     *                timers, or are driven by the owner itself).
+     * @param listed  Register in the pool list walked by Tempo::poll() and
+     *                Tempo::nextDeadline() on first allocation. Pools whose
+     *                slots are not timers pass false.
+     */
+    constexpr SlotPool(Slot* slots, SlotExtra* extra, Id* ids, uint16_t* cells,
+                       uint16_t capacity, uint8_t indexBits, bool listed = true)
+      : _slots(slots), _extra(extra), _ids(ids), _cells(cells), _capacity(capacity),
+        _indexBits(indexBits),
+        _count(0), _fresh(0), _freeHead(0), _due(0), _dueValid(true), _linked(!listed),
+        _next(nullptr) {}
+
+    /**
+     * @brief Position of a slot of this pool in its storage.
+     */
+    size_t position(const Slot* s) const { return (size_t)(s - _slots); }
+
+    /**
+     * @brief Slot at a position of this pool's storage.
+     */
+    Slot* slotAt(size_t pos) const { return &_slots[pos]; }
+
+  private:
+    void  link();
+    Slot* probe(Id id, Kind expected, size_t& cell);
+    bool  unindex(Slot* s);
+
+    friend class DueLock;
+
+    Slot* const      _slots;      ///< Slot storage (never moves)
+    SlotExtra* const _extra;      ///< Cold data, parallel to _slots (may be nullptr)
+    Id* const        _ids;        ///< Dense copy of each slot's Id, scanned by lookups
+    uint16_t* const  _cells;      ///< Hash index, cell = slot position + 1 (0 = empty)
+    const uint16_t   _capacity;
+    const uint8_t    _indexBits;
+    uint16_t         _count;      ///< Allocated (live) slots
+    uint16_t         _fresh;      ///< Slots never handed out start here
+    uint16_t         _freeHead;   ///< Released slots, position + 1 (0 = empty)
+    uint16_t         _due;        ///< Earliest pending slot, position + 1 (0 = none)
+    bool             _dueValid;   ///< _due is up to date
+    bool             _linked;     ///< Registered in the pool list (or never listed)
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    uint32_t         _dueLock  = 0; ///< Deadline cache lock word (DueLock)
+    uint32_t         _shiftSeq = 0; ///< Odd while release() shifts index cells
+#endif
+    SlotPool*        _next;
+  };
+
+  namespace detail {
+
+    /**
+     * @brief Index bits for a pool of N slots (at least 2N cells).
+     */
+    constexpr uint8_t poolIndexBits(size_t n) {
+      uint8_t bits = 1;
+      while ((size_t(1) << bits) < 2 * n) ++bits;
+      return bits;
+    }
+
+  } // namespace detail
+
+  /**
+   * @brief Statically sized slot pool.
+   *
+   * @details
+   * Use separate pools to isolate modules from each other:
+   * @code
+   * static Tempo::Pool<64> netTimers;
+   *
+   * if (netTimers.interval("MQTT_PING"_id).every(15000)) { ... }
+   * @endcode
+   *
+   * Pools should have static storage duration. The index holds twice as many
+   * cells as there are slots, which keeps the load factor at or below 50%.
+   */
+  template <size_t N>
+  class Pool : public SlotPool {
+    static_assert(N > 0 && N < 0x8000, "Pool size must be in [1, 32767]");
+
+  public:
+    constexpr Pool() : SlotPool(_storage, _extra, _ids, _cells, N, detail::poolIndexBits(N)) {}
+
+  private:
+    Slot      _storage[N] = {};
+    SlotExtra _extra[N] = {};
+    Id        _ids[N] = {};
+    uint16_t  _cells[size_t(1) << detail::poolIndexBits(N)] = {};
+  };
+
+  /**
+   * @brief Default pool backing Tempo::interval() / Tempo::oneShot().
+   */
+  SlotPool& defaultPool();
+
+  /**
+   * @brief Milliseconds until the earliest pending timer expires, all pools.
+   *
+   * @details
+   * Intended to size idle periods of the main loop. Covers the default pool
+   * and every Tempo::Pool that has allocated at least one slot. Registry
+   * timers are reported separately by Registry::nextDeadline().
+   *
+   * @return Remaining time, 0 if a timer is already due, or NO_DEADLINE.
+   */
+  uint32_t nextDeadline();
+
+  /**
+   * @brief Call the handlers of all expired timers, all pools, in one pass.
+   *
+   * @details
+   * Walks each pool once with a single timestamp and dispatches the handlers
+   * registered with Interval::onEvery() / OneShot::onDone(). An Interval
+   * fires at most once per poll() (like every(), a stalled loop catches up
+   * one period per call). Timers without a handler are left untouched, so
+   * every() / done() polling can be mixed freely with poll().
+   *
+   * Handlers may start, cancel or release timers, including their own.
+   *
+   * @return Number of handlers called.
+   */
+  size_t poll();
+
+  /**
+   * @brief Report the state of every allocated timer, all pools.
+   *
+   * @details
+   * All timers are evaluated against one timestamp, and each one is read
+   * consistently (also under HESTIA_TEMPO_THREAD_SAFE). Nothing is copied
+   * or allocated: the visitor sees each timer as it is reached, so a dump
+   * of a large pool can be streamed (see snapshotJson()).
+   * @code
+   * Tempo::snapshot([](const Tempo::TimerInfo& t, void*) {
+   *   if (t.kind == Tempo::Kind::OneShot && t.active) log(t.id, t.remaining);
+   * });
+   * @endcode
+   *
+   * Registry, array, group and wheel timers are not part of any pool and
+   * are not visited.
+   *
+   * @return Number of timers visited.
+   */
+  size_t snapshot(SlotPool::SnapshotVisitor fn, void* ctx = nullptr);
+
+#if defined(HESTIA_TEMPO_STATS)
+  /**
+   * @brief Visit the statistics of every allocated timer, all pools.
+   *
+   * @code
+   * Tempo::visitStats([](Tempo::Id id, Tempo::Kind, const Tempo::Stats& st, void*) {
+   *   Serial.printf("%08lx max=%lu mean=%lu\n", (unsigned long)id,
+   *                 (unsigned long)st.maxLate, (unsigned long)st.meanLate());
+   * });
+   * @endcode
+   *
+   * Registry timers are not part of any pool and are not visited.
+   *
+   * @return Number of timers visited.
+   */
+  size_t visitStats(SlotPool::StatsVisitor fn, void* ctx = nullptr);
+
+  /**
+   * @brief Clear the statistics of every timer, all pools.
+   */
+  void resetStats();
+#endif
+
+  // ============================================================================
+  // Timer groups
+  // ============================================================================
+
+  namespace detail {
+
+    /**
+     * @brief Bitmask of the expired members of a group at `now`.
+     */
+    uint32_t groupExpired(const Tick* start, const Tick* period, uint32_t active,
+                          size_t n, Tick now);
+
+    /**
+     * @brief Milliseconds until the earliest running member of a group
+     *        expires (0 if one already has, NO_DEADLINE if none is active).
+     */
+    uint32_t groupDeadline(const Tick* start, const Tick* period, uint32_t active,
+                           size_t n, Tick now);
+
+  } // namespace detail
+
+  /**
+   * @brief Fixed set of up to 32 one-shot timers checked in one pass.
+   *
+   * @details
+   * Members are addressed by index and stored as contiguous start / period
+   * arrays, with their running state in a bitmask. expired() evaluates
+   * every member against a single timestamp in one branch-free loop and
+   * returns the expired members as a bitmask, which replaces N facade calls
+   * (and N lookups) with one call and a walk over the set bits:
+   * @code
+   * static Tempo::Group<16> channelTimeout;
+   *
+   * channelTimeout.start(ch, 500);
+   *
+   * uint32_t due = channelTimeout.expired();
+   * while (due) {
+   *   const unsigned ch = __builtin_ctz(due);
+   *   due &= due - 1;
+   *   channelTimeout.cancel(ch);
+   *   onChannelTimeout(ch);
+   * }
+   * @endcode
+   *
+   * A member reports expiry like OneShot::done(): until it is started again
+   * or cancelled. Out-of-range indices are ignored.
+   *
+   * @note
+   * Groups are independent from the slot pools: they are not covered by
+   * Tempo::nextDeadline() or Tempo::poll(), always use the clock (also with
+   * the esp_timer backend) and must be used from a single task.
+   */
+  template <size_t N>
+  class Group {
+    static_assert(N > 0 && N <= 32, "Group size must be in [1, 32]");
+
+  public:
+    /**
+     * @brief Number of members.
+     */
+    static constexpr size_t size = N;
+
+    constexpr Group() = default;
 
     /**
-     * @brief Cancel the timer.
+     * @brief Start member `i` with a duration in milliseconds.
      */
-    void cancel();
+    void start(size_t i, uint32_t duration_ms) {
+      if (i >= N) return;
+      _start[i]  = detail::now();
+      _period[i] = (Tick)duration_ms * TICKS_PER_MS;
+      _active   |= bit(i);
+    }
 
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
     /**
-     * @brief Check whether the timer is currently running.
+     * @brief Same as start() with a duration in microseconds.
      */
-    bool running() const;
+    void start_us(size_t i, Tick duration_us) {
+      if (i >= N) return;
+      _start[i]  = detail::now();
+      _period[i] = duration_us;
+      _active   |= bit(i);
+    }
+#endif
 
     /**
-     * @brief Check whether the timer has expired.
+     * @brief Restart member `i` with its previous duration, if it is active.
      */
-    bool done() const;
+    void restart(size_t i) {
+      if (i < N && (_active & bit(i))) _start[i] = detail::now();
+    }
 
     /**
-     * @brief Elapsed time since start, in milliseconds.
+     * @brief Cancel member `i`.
      */
-    uint32_t elapsed() const;
+    void cancel(size_t i) {
+      if (i < N) _active &= ~bit(i);
+    }
 
     /**
-     * @brief Remaining time before expiration, in milliseconds.
+     * @brief Cancel every member whose bit is set in `mask` (all by default).
      */
-    uint32_t remaining() const;
-    
+    void cancelAll(uint32_t mask = 0xFFFFFFFFu) { _active &= ~mask; }
+
+    /**
+     * @brief Bitmask of the active members (running or expired).
+     */
+    uint32_t active() const { return _active; }
+
+    /**
+     * @brief Bitmask of the members that have expired.
+     */
+    uint32_t expired() const {
+      return detail::groupExpired(_start, _period, _active, N, detail::now());
+    }
+
+    /**
+     * @brief Same as OneShot::running() for member `i`.
+     */
+    bool running(size_t i) const {
+      return i < N && (_active & bit(i)) && !due(i);
+    }
+
+    /**
+     * @brief Same as OneShot::done() for member `i`.
+     */
+    bool done(size_t i) const { return i < N && (_active & bit(i)) && due(i); }
+
+    /**
+     * @brief Remaining time of member `i`, in milliseconds (0 if inactive).
+     */
+    uint32_t remaining(size_t i) const {
+      if (i >= N) return 0;
+      const uint32_t ms =
+        detail::groupDeadline(&_start[i], &_period[i], _active >> i & 1u, 1, detail::now());
+      return (ms == NO_DEADLINE) ? 0 : ms;
+    }
+
+    /**
+     * @brief Milliseconds until the earliest running member expires.
+     *
+     * @return 0 if a member has already expired, NO_DEADLINE if none is active.
+     */
+    uint32_t nextDeadline() const {
+      return detail::groupDeadline(_start, _period, _active, N, detail::now());
+    }
+
+  private:
+    static constexpr uint32_t bit(size_t i) { return (uint32_t)1 << i; }
+
+    /** Member `i` has reached its deadline (same timestamp as expired()). */
+    bool due(size_t i) const { return (Tick)(detail::now() - _start[i]) >= _period[i]; }
+
+    Tick     _start[N]  = {};
+    Tick     _period[N] = {};
+    uint32_t _active    = 0;
+  };
+
+  // ============================================================================
+  // Timing wheel
+  // ============================================================================
+
+  namespace detail {
+
+    /**
+     * @brief Bucket links and deadline of one timing-wheel entry.
+     */
+    struct WheelEntry {
+      uint32_t expires = 0;  ///< Deadline (wheel milliseconds)
+      uint16_t next    = 0;  ///< Next entry in the bucket, position + 1 (0 = end)
+      uint16_t prev    = 0;  ///< Previous entry in the bucket, position + 1 (0 = head)
+      uint16_t bucket  = 0;  ///< Bucket holding the entry (level * 64 + index)
+    };
+
+  } // namespace detail
+
+  /**
+   * @brief High-volume timeouts on a hierarchical timing wheel.
+   *
+   * @details
+   * Built for hundreds of concurrent, short-lived timeouts with runtime
+   * Ids (per-message acks, per-request deadlines), where polling a flat
+   * table for expiry would cost a pass over every entry:
+   *  - start() / cancel() are O(1): an Id lookup in the wheel's own hashed
+   *    index and a doubly linked bucket insert or unlink
+   *  - poll() only visits buckets that are due. Empty stretches of time
+   *    are skipped through per-level occupancy masks, and far deadlines
+   *    cascade down one level at a time
+   *
+   * The wheel has 5 levels of 64 buckets at 1 ms resolution, so deadlines
+   * up to ~12 days are placed directly; longer ones (up to MAX_TIMEOUT_MS,
+   * ~24.6 days) are re-placed when their bucket comes due. Timeouts are
+   * one-shot: an expired timeout is removed before its handler runs.
+   *
+   * TimerWheel is the storage-agnostic part; wheels are declared with
+   * Tempo::Wheel<N>:
+   * @code
+   * static Tempo::Wheel<512> ackTimeouts;
+   *
+   * ackTimeouts.start(msgId, 2000);   // on publish
+   * ackTimeouts.cancel(msgId);        // on PUBACK
+   *
+   * ackTimeouts.poll([](Tempo::Id id, void*) { retransmit(id); });
+   * @endcode
+   *
+   * @note
+   * Wheels are independent from the slot pools and Tempo::poll(), always
+   * use the clock (also with the esp_timer backend) and must be used from
+   * a single task.
+   */
+  class TimerWheel : private SlotPool {
+  public:
+    /** Number of levels. */
+    static constexpr size_t LEVELS = 5;
+
+    /** Buckets per level (6 bits of the deadline each). */
+    static constexpr size_t BUCKETS = 64;
+
+    /**
+     * Longest timeout start() accepts (2^31 - 2^24 ms, ~24.6 days). The
+     * margin to the signed 32-bit range absorbs wheel time lagging behind
+     * the clock between two poll() calls.
+     */
+    static constexpr uint32_t MAX_TIMEOUT_MS = 0x7F000000u;
+
+    using SlotPool::capacity;
+    using SlotPool::used;
+
+    /**
+     * @brief Start (or restart) the timeout of an Id.
+     *
+     * @details
+     * Timeouts longer than MAX_TIMEOUT_MS are saturated to it (remaining()
+     * then reports MAX_TIMEOUT_MS): expiry is computed on the wrapping
+     * millisecond clock, so a longer span would read as already past and
+     * fire at the next poll(). The timeout runs from the clock, also when
+     * the wheel has not been polled for a while (up to ~4.6 hours for a
+     * saturated timeout; a longer lag shortens it).
+     *
+     * @return false if the wheel is full (Error::SlotTableFull).
+     */
+    bool start(Id id, uint32_t timeout_ms);
+
+    /**
+     * @brief Cancel the timeout of an Id.
+     *
+     * @return true if a pending timeout was removed.
+     */
+    bool cancel(Id id);
+
+    /**
+     * @brief Check whether an Id has a pending timeout (started, and neither
+     *        dispatched by poll() nor cancelled).
+     */
+    bool running(Id id);
+
+    /**
+     * @brief Time before an Id's timeout expires, in milliseconds
+     *        (0 if unknown or overdue).
+     */
+    uint32_t remaining(Id id);
+
+    /**
+     * @brief Expire every timeout due now, calling `fn` once per timeout.
+     *
+     * @details
+     * Each timeout is removed before its handler runs, so the handler may
+     * start the same Id again, or start and cancel any other timeout.
+     *
+     * @return Number of timeouts that expired.
+     */
+    size_t poll(Handler fn, void* ctx = nullptr);
+
+    /**
+     * @brief Milliseconds until the next bucket of the wheel comes due.
+     *
+     * @details
+     * Exact when the earliest timeout is less than 64 ms away, a lower
+     * bound otherwise (the bucket cascades before the timeout expires).
+     *
+     * @return 0 if poll() has work now, NO_DEADLINE if the wheel is empty.
+     */
+    uint32_t nextDeadline() const;
+
+  protected:
+    constexpr TimerWheel(Slot* slots, Id* ids, uint16_t* cells, detail::WheelEntry* entries,
+                         uint16_t capacity, uint8_t indexBits)
+      : SlotPool(slots, nullptr, ids, cells, capacity, indexBits, false), _entries(entries) {}
+
+  private:
+    void   place(uint16_t pos);
+    void   unlink(uint16_t pos);
+    void   cascade();
+    size_t expireBucket(size_t bucket, Handler fn, void* ctx);
+
+    detail::WheelEntry* const _entries;
+    uint16_t _heads[LEVELS * BUCKETS] = {};  ///< Bucket lists, position + 1 (0 = empty)
+    uint64_t _occupied[LEVELS] = {};         ///< Non-empty buckets, one bit each
+    uint32_t _now = 0;                       ///< Wheel time: processed up to here (ms)
+  };
+
+  /**
+   * @brief Statically sized timing wheel of up to N concurrent timeouts.
+   *
+   * @details
+   * Besides the fixed bucket table, each timeout costs one slot, one index
+   * cell pair and a 12-byte bucket link.
+   */
+  template <size_t N>
+  class Wheel : public TimerWheel {
+    static_assert(N > 0 && N < 0x8000, "Wheel size must be in [1, 32767]");
+
+  public:
+    constexpr Wheel()
+      : TimerWheel(_storage, _ids, _cells, _entries, N, detail::poolIndexBits(N)) {}
+
+  private:
+    Slot               _storage[N] = {};
+    Id                 _ids[N] = {};
+    uint16_t           _cells[size_t(1) << detail::poolIndexBits(N)] = {};
+    detail::WheelEntry _entries[N] = {};
+  };
+
+#if defined(HESTIA_TEMPO_RTC_POOL)
+  // ============================================================================
+  // Deep-sleep persistent pool (HESTIA_TEMPO_RTC_POOL)
+  // ============================================================================
+  /**
+   * @brief Pool of HESTIA_TEMPO_RTC_SLOTS timers that survives deep sleep.
+   *
+   * @details
+   * The pool lives in RTC slow memory (RTC_DATA_ATTR). The first call after
+   * each boot shifts the running timers by the time the RTC timer counted
+   * while the engine clock was not running, so elapsed() / remaining() /
+   * done() continue as if the chip had stayed awake:
+   * @code
+   * auto reprovision = Tempo::rtcPool().oneShot("REPROVISION"_id);
+   *
+   * if (!reprovision.running() && !reprovision.done()) reprovision.start("24:00:00");
+   * if (reprovision.done()) {
+   *   provision();
+   *   reprovision.start("24:00:00");
+   * }
+   * esp_deep_sleep(60 * 1000000ULL);
+   * @endcode
+   *
+   * What survives is the timing state: Ids, kinds, start, period and
+   * policies. Handlers, their contexts and the duration-string cache point
+   * into memory that does not survive deep sleep, and are cleared on wake.
+   * A power-on reset, or a firmware with another slot layout, starts with
+   * an empty pool.
+   *
+   * The pool is kept off the pool list: Tempo::nextDeadline() and
+   * Tempo::poll() do not cover it, call rtcPool().nextDeadline() instead.
+   * Make the first call from setup(), before several tasks use the pool.
+   */
+  SlotPool& rtcPool();
+#endif
+
+#if defined(HESTIA_TEMPO_PROFILE)
+  // ============================================================================
+  // Code-section profiler (HESTIA_TEMPO_PROFILE)
+  // ============================================================================
+
+  /**
+   * @brief Accumulated cost of one profiled section (microseconds).
+   */
+  struct ProfileStats {
+    uint32_t count = 0;           ///< Completed scopes
+    uint32_t minUs = 0xFFFFFFFF;  ///< Shortest scope
+    uint32_t maxUs = 0;           ///< Longest scope
+    uint64_t sumUs = 0;           ///< Total time spent in the section
+
+    /** Mean duration, 0 if nothing was recorded. */
+    uint32_t meanUs() const { return count ? (uint32_t)(sumUs / count) : 0; }
+  };
+
+  /**
+   * @brief RAII scope timer: measures its own lifetime.
+   *
+   * @details
+   * The constructor only latches micros(); the section is looked up and
+   * updated when the scope ends, so the lookup is not part of the
+   * measurement. Prefer the TEMPO_PROFILE() macro, which compiles away
+   * without HESTIA_TEMPO_PROFILE.
+   *
+   * If the profile table is full, further Ids are not recorded; outside
+   * HESTIA_TEMPO_MINIMAL, lastError() then reports SlotTableFull.
+   */
+  class Profile {
+  public:
+    explicit Profile(Id id);
+    ~Profile();
+
+    Profile(const Profile&) = delete;
+    Profile& operator=(const Profile&) = delete;
 
   private:
-    Id _id;
+    Id       _id;
+    uint32_t _start;
+  };
+
+  /**
+   * @brief Profile visitor: called once per recorded section.
+   */
+  using ProfileVisitor = void (*)(Id id, const ProfileStats& stats, void* ctx);
+
+  /**
+   * @brief Visit every recorded section.
+   *
+   * @return Number of sections visited.
+   */
+  size_t visitProfiles(ProfileVisitor fn, void* ctx = nullptr);
+
+  /**
+   * @brief Clear all recorded sections.
+   */
+  void resetProfiles();
+
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+  /**
+   * @brief Write one line per section: "id count min avg max" (µs, id in hex).
+   *
+   * @return Number of bytes accepted by the sink.
+   */
+  size_t profileReport(Print& out);
+#endif
+#endif
+
+  // ============================================================================
+  // Frame timestamp (opt-in)
+  // ============================================================================
+
+  /**
+   * @brief Latch the engine time for the current loop iteration.
+   *
+   * @return The latched timestamp (engine ticks: milliseconds by default).
+   *
+   * @details
+   * Until the next beginFrame() (or endFrame()), every Interval / OneShot
+   * query reads this timestamp instead of calling millis(). All timers
+   * checked in one iteration therefore see the same "now", which makes
+   * their relative ordering deterministic and saves one millis() per call.
+   *
+   * @code
+   * void loop() {
+   *   Tempo::beginFrame();
+   *   // ... every() / done() checks ...
+   * }
+   * @endcode
+   *
+   * @note
+   * Time does not advance inside a frame: do not busy-wait on a timer
+   * between two beginFrame() calls.
+   */
+  Tick beginFrame();
+
+  /**
+   * @brief Leave frame mode: queries read millis() again.
+   */
+  void endFrame();
+
+  // ============================================================================
+  // Idle helper (opt-in)
+  // ============================================================================
+
+  /**
+   * @brief How idle() waits for the next deadline.
+   */
+  enum class IdleMode : uint8_t {
+    /** Yield the CPU (FreeRTOS vTaskDelay on ESP32, delay() elsewhere). */
+    Delay,
+
+    /**
+     * ESP32 light sleep with a timer wake-up (falls back to Delay on other
+     * targets, and for waits too short to be worth a sleep cycle).
+     *
+     * @warning
+     * Native USB serial (USB CDC on C3/S3) is suspended during light sleep.
+     */
+    LightSleep
   };
 
+  /**
+   * @brief Wait until the earliest pending timer is due, then return.
+   *
+   * @param max_ms Upper bound on the wait (e.g. to keep polling inputs).
+   * @param mode   Waiting strategy.
+   * @return Number of milliseconds waited (0 if a timer is already due, or
+   *         if nothing is pending and no bound was given).
+   *
+   * @details
+   * Typical use at the end of loop():
+   * @code
+   * void loop() {
+   *   if (Tempo::interval("SENSOR"_id).every(1000)) { ... }
+   *   Tempo::idle(100, Tempo::IdleMode::LightSleep);
+   * }
+   * @endcode
+   *
+   * The wait is derived from Tempo::nextDeadline(). Registry timers are not
+   * included; bound the wait with Registry::nextDeadline() if needed.
+   *
+   * Ends the current frame (see beginFrame()) before measuring the wait.
+   */
+  uint32_t idle(uint32_t max_ms = NO_DEADLINE, IdleMode mode = IdleMode::Delay);
+
+  // ============================================================================
+  // Registry accessors
+  // ============================================================================
+
+  template <typename... Timers>
+  template <Id ID>
+  IntervalHandle Registry<Timers...>::interval() {
+    static_assert(detail::registryKind<ID, Timers...>() != Kind::OneShot,
+                  "Registry: Id is declared as a OneShot");
+    return IntervalHandle(ID, &_slots[indexOf<ID>()], cache(indexOf<ID>()));
+  }
+
+  template <typename... Timers>
+  template <Id ID>
+  OneShotHandle Registry<Timers...>::oneShot() {
+    static_assert(detail::registryKind<ID, Timers...>() != Kind::Interval,
+                  "Registry: Id is declared as an Interval");
+    return OneShotHandle(ID, &_slots[indexOf<ID>()], cache(indexOf<ID>()));
+  }
+
   // ============================================================================
   // Facade entry points
   // ============================================================================
@@ -279,6 +2454,14 @@ Error lastError();
    */
   OneShot oneShot(Id id);
 
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  /**
+   * @brief Obtain a RateLimit facade for a given Id.
+   */
+  RateLimit rateLimit(Id id);
+#endif
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
   // ============================================================================
   // Formatting helpers (diagnostics / logging)
   // ============================================================================
@@ -296,4 +2479,133 @@ Error lastError();
    */
   const char* elapsedStr(Id id, Format fmt = Format::AUTO_SHORT);
 
+  /**
+   * @brief Format remaining time into a caller-supplied buffer.
+   *
+   * @param out  Output buffer (FORMAT_BUFFER_SIZE always fits every format).
+   * @param len  Size of `out`; the output is truncated to len - 1 characters.
+   * @return Number of characters written, excluding the terminator.
+   *
+   * Re-entrant: several results can be used in the same print call, and
+   * different tasks may format concurrently.
+   */
+  size_t remainingStr(Id id, char* out, size_t len, Format fmt = Format::AUTO_SHORT);
+
+  /**
+   * @brief Format elapsed time into a caller-supplied buffer.
+   *
+   * @see remainingStr(Id, char*, size_t, Format)
+   */
+  size_t elapsedStr(Id id, char* out, size_t len, Format fmt = Format::AUTO_SHORT);
+
+#if defined(ARDUINO)
+  // ============================================================================
+  // Print output (Arduino)
+  // ============================================================================
+  /**
+   * @brief Write remaining time to a Print sink (Serial, WiFiClient, ...).
+   *
+   * @details
+   * The digits are formatted on the stack and handed to the sink in a
+   * single write(); no static buffer is involved.
+   *
+   * @return Number of bytes accepted by the sink.
+   */
+  size_t printRemaining(Print& out, Id id, Format fmt = Format::AUTO_SHORT);
+
+  /**
+   * @brief Write elapsed time to a Print sink.
+   *
+   * @see printRemaining()
+   */
+  size_t printElapsed(Print& out, Id id, Format fmt = Format::AUTO_SHORT);
+
+  /**
+   * @brief Batch several formatted fields into one write to a Print sink.
+   *
+   * @details
+   * Fields are formatted in place into a fixed stack buffer and written
+   * when the buffer fills up, on flush(), or on destruction:
+   * @code
+   * Tempo::PrintBatch(Serial)
+   *   .text("wdt=").remaining("WDT"_id, Tempo::Format::HMS)
+   *   .text(" up=").elapsed("UPTIME"_id, Tempo::Format::HMS_MS)
+   *   .text("\r\n");
+   * @endcode
+   */
+  class PrintBatch {
+  public:
+    /** Size of the batching buffer (bytes). */
+    static constexpr size_t CAPACITY = 64;
+
+    explicit PrintBatch(Print& out) : _out(out) {}
+    ~PrintBatch() { flush(); }
+
+    PrintBatch(const PrintBatch&) = delete;
+    PrintBatch& operator=(const PrintBatch&) = delete;
+
+    PrintBatch& remaining(Id id, Format fmt = Format::AUTO_SHORT);
+    PrintBatch& elapsed(Id id, Format fmt = Format::AUTO_SHORT);
+
+    /** Append raw text. */
+    PrintBatch& text(const char* str);
+
+    /** Append an unsigned decimal number. */
+    PrintBatch& number(uint32_t value);
+
+    /** Append a number as 8 lowercase hexadecimal digits. */
+    PrintBatch& hex(uint32_t value);
+
+    /**
+     * @brief Write pending bytes to the sink.
+     *
+     * @return Total bytes accepted by the sink since construction.
+     */
+    size_t flush();
+
+  private:
+    char*  reserve(size_t n);
+
+    Print& _out;
+    char   _buf[CAPACITY];
+    size_t _len     = 0;
+    size_t _written = 0;
+  };
+
+  /**
+   * @brief Stream Tempo::snapshot() to a Print sink as a JSON array.
+   *
+   * @details
+   * Each timer is formatted as it is visited and written through a
+   * PrintBatch, so the dump needs no document, no heap and at most
+   * PrintBatch::CAPACITY bytes of stack, whatever the number of timers.
+   * The sink can be Serial, a network client, or any Print adapter
+   * (e.g. an MQTT client's publish stream):
+   * @code
+   * [{"id":"1f3a9c2e","kind":"interval","active":true,"elapsed":120,
+   *   "remaining":880,"overruns":0}, ...]
+   * @endcode
+   *
+   * @return Number of bytes accepted by the sink.
+   */
+  size_t snapshotJson(Print& out);
+#endif
+#endif // !HESTIA_TEMPO_MINIMAL
+
 } // namespace Tempo
+
+/**
+ * @brief Profile the rest of the enclosing scope under a Tempo::Id.
+ *
+ * @code
+ * { TEMPO_PROFILE("MQTT_RX"_id); handleMqtt(); }
+ * @endcode
+ */
+#define HESTIA_TEMPO_CONCAT_(a, b) a##b
+#define HESTIA_TEMPO_CONCAT(a, b)  HESTIA_TEMPO_CONCAT_(a, b)
+
+#if defined(HESTIA_TEMPO_PROFILE)
+#define TEMPO_PROFILE(id) ::Tempo::Profile HESTIA_TEMPO_CONCAT(tempoProfile_, __LINE__)(id)
+#else
+#define TEMPO_PROFILE(id) do {} while (0)
+#endif
@@ -1,5 +1,7 @@
+#include "HestiaTempo.h"
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
 #include "HestiaTempoFormat.h"
-#include <stdio.h>
 
 /**
  * @file    HestiaTempoFormat.cpp
@@ -8,11 +10,13 @@
  * @details
  * This file implements the presentation layer of HestiaTempo.
  * It converts raw millisecond durations into human-readable strings
- * and parses strict textual durations into milliseconds.
+ * and parses strict textual durations into milliseconds (the parser
+ * itself is the constexpr Tempo::detail::parseDuration()).
  *
  * Design goals:
  *  - No dynamic allocation
  *  - No Arduino String
+ *  - No printf / scanf (digits come from a two-digit table)
  *  - Deterministic output
  *  - Small code size
  *
@@ -27,32 +31,64 @@ namespace HestiaTempoFormat {
   // ============================================================================
 
   /**
-   * @brief Format milliseconds as "HH:MM:SS.mmm".
+   * @brief Two-digit lookup table ("00" .. "99").
    */
-  static void formatHMSms(uint32_t ms, char* out, size_t len) {
-    const uint32_t totalSeconds = ms / 1000UL;
-    const uint32_t milliseconds = ms % 1000UL;
+  static const char DIGITS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
 
-    const uint32_t seconds = totalSeconds % 60UL;
-    const uint32_t totalMinutes = totalSeconds / 60UL;
-    const uint32_t minutes = totalMinutes % 60UL;
-    const uint32_t hours   = totalMinutes / 60UL;
+  /**
+   * @brief Bounded output cursor (always leaves room for the terminator).
+   */
+  struct Writer {
+    char* p;
+    char* end;
 
-    snprintf(
-      out,
-      len,
-      "%02lu:%02lu:%02lu.%03lu",
-      hours,
-      minutes,
-      seconds,
-      milliseconds
-    );
-  }
+    void put(char c) {
+      if (p < end) *p++ = c;
+    }
+
+    void text(const char* s) {
+      while (*s) put(*s++);
+    }
+
+    /**
+     * @brief Write `v` in decimal, zero-padded to at least `width` digits.
+     */
+    void num(uint32_t v, uint8_t width = 1) {
+      char    tmp[10];
+      uint8_t n = 0;
+
+      while (v >= 100) {
+        const uint32_t r = (v % 100) * 2;
+        v /= 100;
+        tmp[n++] = DIGITS[r + 1];
+        tmp[n++] = DIGITS[r];
+      }
+      if (v >= 10) {
+        tmp[n++] = DIGITS[v * 2 + 1];
+        tmp[n++] = DIGITS[v * 2];
+      } else {
+        tmp[n++] = (char)('0' + v);
+      }
+
+      while (n < width) tmp[n++] = '0';
+      while (n) put(tmp[--n]);
+    }
+  };
 
   /**
-   * @brief Format milliseconds as "HH:MM:SS".
+   * @brief Format milliseconds as "HH:MM:SS", optionally with ".mmm".
    */
-  static void formatHMS(uint32_t ms, char* out, size_t len) {
+  static void formatHMS(uint32_t ms, Writer& w, bool millis) {
     const uint32_t totalSeconds = ms / 1000UL;
 
     const uint32_t seconds = totalSeconds % 60UL;
@@ -60,67 +96,70 @@ namespace HestiaTempoFormat {
     const uint32_t minutes = totalMinutes % 60UL;
     const uint32_t hours   = totalMinutes / 60UL;
 
-    snprintf(
-      out,
-      len,
-      "%02lu:%02lu:%02lu",
-      hours,
-      minutes,
-      seconds
-    );
-  }
+    w.num(hours, 2);
+    w.put(':');
+    w.num(minutes, 2);
+    w.put(':');
+    w.num(seconds, 2);
 
-  /**
-   * @brief Format milliseconds as a raw millisecond string.
-   */
-  static void formatMS(uint32_t ms, char* out, size_t len) {
-    snprintf(out, len, "%lu", ms);
+    if (millis) {
+      w.put('.');
+      w.num(ms % 1000UL, 3);
+    }
   }
 
   /**
    * @brief Format milliseconds using a human-friendly short representation.
    */
-  static void formatAutoShort(uint32_t ms, char* out, size_t len) {
+  static void formatAutoShort(uint32_t ms, Writer& w) {
     if (ms < 1000UL) {
-      snprintf(out, len, "%lu ms", ms);
+      w.num(ms);
+      w.text(" ms");
       return;
     }
 
     if (ms < 60000UL) {
-      snprintf(out, len, "%lu sec", ms / 1000UL);
+      w.num(ms / 1000UL);
+      w.text(" sec");
       return;
     }
 
-    snprintf(out, len, "%lu min", ms / 60000UL);
+    w.num(ms / 60000UL);
+    w.text(" min");
   }
 
   // ============================================================================
   // Public formatting entry point
   // ============================================================================
 
-  void format(uint32_t ms, char* out, size_t len, TimeFormat fmt) {
+  size_t format(uint32_t ms, char* out, size_t len, TimeFormat fmt) {
     if (!out || len == 0) {
-      return;
+      return 0;
     }
 
+    Writer w{ out, out + len - 1 };
+
     switch (fmt) {
       case TimeFormat::HMS_MS:
-        formatHMSms(ms, out, len);
+        formatHMS(ms, w, true);
         break;
 
       case TimeFormat::HMS:
-        formatHMS(ms, out, len);
+        formatHMS(ms, w, false);
         break;
 
       case TimeFormat::MS:
-        formatMS(ms, out, len);
+        w.num(ms);
         break;
 
       case TimeFormat::AUTO_SHORT:
       default:
-        formatAutoShort(ms, out, len);
+        formatAutoShort(ms, w);
         break;
     }
+
+    *w.p = '\0';
+    return (size_t)(w.p - out);
   }
 
   // ============================================================================
@@ -128,51 +167,34 @@ namespace HestiaTempoFormat {
   // ============================================================================
 
   bool parseHMS(const char* str, uint32_t& out_ms) {
-    if (!str) return false;
-
-    uint32_t hh = 0;
-    uint32_t mm = 0;
-    uint32_t ss = 0;
-    char tail = 0;
-
-    // Strict "HH:MM:SS" parsing.
-    // The trailing character ensures full-string validation.
-    const int n = sscanf(str, "%lu:%lu:%lu%c", &hh, &mm, &ss, &tail);
-    if (n != 3) return false;
-    if (mm > 59 || ss > 59) return false;
-
-    out_ms =
-      hh * 3600000UL +
-      mm *   60000UL +
-      ss *    1000UL;
-
-    return true;
+    // Strict "HH:MM:SS", sharing the engine's allocation-free parser.
+    return Tempo::detail::parseDuration(str, (size_t)-1, out_ms, true);
   }
 
   // ============================================================================
   // Internal string helpers
   // ============================================================================
 
+  size_t remainingStr(Tempo::Id id, char* out, size_t len, TimeFormat fmt) {
+    return format(Tempo::oneShot(id).remaining(), out, len, fmt);
+  }
+
+  size_t elapsedStr(Tempo::Id id, char* out, size_t len, TimeFormat fmt) {
+    return format(Tempo::oneShot(id).elapsed(), out, len, fmt);
+  }
+
   const char* remainingStr(Tempo::Id id, TimeFormat fmt) {
-    static char buf[16];
-    format(
-      Tempo::oneShot(id).remaining(),
-      buf,
-      sizeof(buf),
-      fmt
-    );
+    static char buf[Tempo::FORMAT_BUFFER_SIZE];
+    HestiaTempoFormat::remainingStr(id, buf, sizeof(buf), fmt);
     return buf;
   }
 
   const char* elapsedStr(Tempo::Id id, TimeFormat fmt) {
-    static char buf[16];
-    format(
-      Tempo::oneShot(id).elapsed(),
-      buf,
-      sizeof(buf),
-      fmt
-    );
+    static char buf[Tempo::FORMAT_BUFFER_SIZE];
+    HestiaTempoFormat::elapsedStr(id, buf, sizeof(buf), fmt);
     return buf;
   }
 
 } // namespace HestiaTempoFormat
+
+#endif // !HESTIA_TEMPO_MINIMAL
@@ -3,6 +3,10 @@
 #include <stddef.h>
 #include "HestiaTempo.h"
 
+#if defined(HESTIA_TEMPO_MINIMAL)
+#error "HestiaTempoFormat.h is not available with HESTIA_TEMPO_MINIMAL"
+#endif
+
 /**
  * @file    HestiaTempoFormat.h
  * @brief   Formatting and parsing utilities for HestiaTempo.
@@ -53,17 +57,20 @@ namespace HestiaTempoFormat {
    * @param fmt  Formatting policy.
    *
    * @details
+   * @return Number of characters written, excluding the terminator.
+   *
    * The function guarantees:
    *  - Null-terminated output (if len > 0)
-   *  - No buffer overflow
+   *  - No buffer overflow (output is truncated to len - 1 characters)
+   *  - Re-entrancy (no shared state)
    *
    * Formatting policies:
    *  - HMS_MS     → "HH:MM:SS.mmm"
    *  - HMS        → "HH:MM:SS"
-   *  - MS         → raw milliseconds (implementation-defined text)
+   *  - MS         → raw milliseconds ("3512")
    *  - AUTO_SHORT → "123 ms", "5 sec", "2 min"
    */
-  void format(uint32_t ms, char* out, size_t len, TimeFormat fmt);
+  size_t format(uint32_t ms, char* out, size_t len, TimeFormat fmt);
 
   // ============================================================================
   // Parsing
@@ -98,6 +105,20 @@ namespace HestiaTempoFormat {
   // Internal string helpers (used by Tempo facade)
   // ============================================================================
 
+  /**
+   * @brief Format remaining time into a caller buffer (re-entrant).
+   *
+   * @return Number of characters written, excluding the terminator.
+   */
+  size_t remainingStr(Tempo::Id id, char* out, size_t len, TimeFormat fmt);
+
+  /**
+   * @brief Format elapsed time into a caller buffer (re-entrant).
+   *
+   * @return Number of characters written, excluding the terminator.
+   */
+  size_t elapsedStr(Tempo::Id id, char* out, size_t len, TimeFormat fmt);
+
   /**
    * @brief Return remaining time as a formatted string.
    *
@@ -0,0 +1,85 @@
+#include "HestiaTempo.h"
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_sleep.h>
+#endif
+
+/**
+ * @file    HestiaTempoIdle.cpp
+ * @brief   Deadline-driven idle helper for HestiaTempo.
+ *
+ * @details
+ * This file turns the engine's next-deadline information into an actual
+ * wait. It is kept apart from the timing engine because it is the only part
+ * of the library that blocks, and the only one depending on the target's
+ * power management.
+ *
+ * Nothing here is linked unless Tempo::idle() is used.
+ */
+
+namespace Tempo {
+
+  /**
+   * @brief Shortest wait worth a light sleep cycle (milliseconds).
+   *
+   * @note
+   * Entering and leaving light sleep costs on the order of a millisecond;
+   * shorter waits are served by a plain delay.
+   */
+  static constexpr uint32_t LIGHT_SLEEP_MIN_MS = 3;
+
+  /**
+   * @brief Yield the CPU for a number of milliseconds.
+   */
+  static void idleDelay(uint32_t ms) {
+    if (Clock::simulated) {
+      // Simulated time: the wait completes instantly
+      VirtualClock::advanceMs(ms);
+      return;
+    }
+
+    // An accelerated clock covers the wait in less real time
+    ms /= HESTIA_TEMPO_CLOCK_SCALE;
+
+#if defined(ARDUINO)
+#if defined(ARDUINO_ARCH_ESP32)
+    const TickType_t ticks = pdMS_TO_TICKS(ms);
+    vTaskDelay(ticks > 0 ? ticks : 1);
+#else
+    delay(ms);
+#endif
+#endif
+  }
+
+  uint32_t idle(uint32_t max_ms, IdleMode mode) {
+    // A latched frame timestamp would overstate the remaining time
+    endFrame();
+
+    uint32_t wait = nextDeadline();
+    if (max_ms < wait) wait = max_ms;
+
+    // Nothing due and nothing pending: nothing to wait for
+    if (wait == 0 || wait == NO_DEADLINE) return 0;
+
+#if defined(ARDUINO_ARCH_ESP32)
+    if (mode == IdleMode::LightSleep && !Clock::simulated && HESTIA_TEMPO_CLOCK_SCALE == 1 &&
+        wait >= LIGHT_SLEEP_MIN_MS) {
+      // millis() is compensated for the time spent in light sleep
+      esp_sleep_enable_timer_wakeup((uint64_t)wait * 1000ULL);
+      if (esp_light_sleep_start() == ESP_OK) return wait;
+    }
+#else
+    (void)mode;
+#endif
+
+    idleDelay(wait);
+    return wait;
+  }
+
+} // namespace Tempo
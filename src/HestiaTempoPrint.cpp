@@ -0,0 +1,139 @@
+#include "HestiaTempo.h"
+
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+#include "HestiaTempoFormat.h"
+#include <Arduino.h>
+
+/**
+ * @file    HestiaTempoPrint.cpp
+ * @brief   Formatted output to Arduino Print sinks.
+ *
+ * @details
+ * Thin layer over the re-entrant formatting helpers: durations are formatted
+ * on the stack and passed to Print::write() in one call, so the sink receives
+ * a single block instead of one byte at a time, and no static buffer is
+ * shared between callers.
+ *
+ * Nothing here is linked unless the print helpers are used.
+ */
+
+namespace Tempo {
+
+  size_t printRemaining(Print& out, Id id, Format fmt) {
+    char buf[FORMAT_BUFFER_SIZE];
+    const size_t n = remainingStr(id, buf, sizeof(buf), fmt);
+    return out.write(reinterpret_cast<const uint8_t*>(buf), n);
+  }
+
+  size_t printElapsed(Print& out, Id id, Format fmt) {
+    char buf[FORMAT_BUFFER_SIZE];
+    const size_t n = elapsedStr(id, buf, sizeof(buf), fmt);
+    return out.write(reinterpret_cast<const uint8_t*>(buf), n);
+  }
+
+  // ============================================================================
+  // PrintBatch
+  // ============================================================================
+
+  /**
+   * @brief Make room for `n` bytes, flushing first if they do not fit.
+   */
+  char* PrintBatch::reserve(size_t n) {
+    if (_len + n > CAPACITY) flush();
+    return _buf + _len;
+  }
+
+  PrintBatch& PrintBatch::remaining(Id id, Format fmt) {
+    _len += remainingStr(id, reserve(FORMAT_BUFFER_SIZE), FORMAT_BUFFER_SIZE, fmt);
+    return *this;
+  }
+
+  PrintBatch& PrintBatch::elapsed(Id id, Format fmt) {
+    _len += elapsedStr(id, reserve(FORMAT_BUFFER_SIZE), FORMAT_BUFFER_SIZE, fmt);
+    return *this;
+  }
+
+  PrintBatch& PrintBatch::number(uint32_t value) {
+    _len += HestiaTempoFormat::format(value, reserve(FORMAT_BUFFER_SIZE), FORMAT_BUFFER_SIZE,
+                                      Format::MS);
+    return *this;
+  }
+
+  PrintBatch& PrintBatch::hex(uint32_t value) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    char* p = reserve(8);
+    for (int i = 7; i >= 0; --i) {
+      p[i] = HEX_DIGITS[value & 0xF];
+      value >>= 4;
+    }
+    _len += 8;
+    return *this;
+  }
+
+  PrintBatch& PrintBatch::text(const char* str) {
+    if (!str) return *this;
+
+    while (*str) {
+      if (_len == CAPACITY) flush();
+      _buf[_len++] = *str++;
+    }
+    return *this;
+  }
+
+  size_t PrintBatch::flush() {
+    if (_len > 0) {
+      _written += _out.write(reinterpret_cast<const uint8_t*>(_buf), _len);
+      _len = 0;
+    }
+    return _written;
+  }
+
+  // ============================================================================
+  // JSON snapshot
+  // ============================================================================
+
+  namespace {
+
+    struct JsonState {
+      PrintBatch* batch;
+      bool        first;
+    };
+
+    const char* kindName(Kind kind) {
+      switch (kind) {
+        case Kind::Interval:  return "interval";
+        case Kind::OneShot:   return "oneshot";
+        case Kind::RateLimit: return "ratelimit";
+        default:              return "other";
+      }
+    }
+
+    void jsonTimer(const TimerInfo& t, void* ctx) {
+      JsonState& st = *static_cast<JsonState*>(ctx);
+
+      st.batch->text(st.first ? "{\"id\":\"" : ",{\"id\":\"").hex(t.id)
+               .text("\",\"kind\":\"").text(kindName(t.kind))
+               .text("\",\"active\":").text(t.active ? "true" : "false")
+               .text(",\"elapsed\":").number(t.elapsed)
+               .text(",\"remaining\":").number(t.remaining)
+               .text(",\"overruns\":").number(t.overruns)
+               .text("}");
+      st.first = false;
+    }
+
+  } // namespace
+
+  size_t snapshotJson(Print& out) {
+    PrintBatch batch(out);
+    JsonState  st = { &batch, true };
+
+    batch.text("[");
+    snapshot(&jsonTimer, &st);
+    batch.text("]");
+    return batch.flush();
+  }
+
+} // namespace Tempo
+
+#endif // ARDUINO && !HESTIA_TEMPO_MINIMAL
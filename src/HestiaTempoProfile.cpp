@@ -0,0 +1,156 @@
+#include "HestiaTempo.h"
+
+#if defined(HESTIA_TEMPO_PROFILE)
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+/**
+ * @file    HestiaTempoProfile.cpp
+ * @brief   Scoped code-section profiler for HestiaTempo.
+ *
+ * @details
+ * Durations come from micros() (std::chrono on host builds).
+ *
+ * Sections are keyed by Tempo::Id and stored in a private slot table using
+ * the same hashed index as the timer pools. The table is kept off the pool
+ * list, so Tempo::poll() and Tempo::nextDeadline() never see it.
+ *
+ * Under HESTIA_TEMPO_THREAD_SAFE the accumulators are updated with atomic
+ * operations, so sections may be profiled from several tasks.
+ */
+
+namespace Tempo {
+
+  namespace {
+
+    /**
+     * @brief Slot tag of profile entries.
+     *
+     * @details
+     * Outside the public Kind values: the table is private and never seen
+     * by facades, snapshots or Tempo::poll(), so its tag stays private too.
+     */
+    constexpr Kind PROFILE_KIND = static_cast<Kind>(0xFF);
+
+    /**
+     * @brief Profile storage: one slot (Id + index) and one record per section.
+     */
+    class ProfileTable : public SlotPool {
+    public:
+      static constexpr size_t N = HESTIA_TEMPO_PROFILE_SLOTS;
+
+      constexpr ProfileTable()
+        : SlotPool(_storage, nullptr, _ids, _cells, N, detail::poolIndexBits(N), false) {}
+
+      ProfileStats* find(Id id) {
+        Slot* s = slot(id, PROFILE_KIND);
+        return s ? &_stats[s - _storage] : nullptr;
+      }
+
+      template <typename F>
+      size_t each(F f) {
+        size_t n = 0;
+        for (size_t i = 0; i < N; ++i) {
+          if (_storage[i].kind != PROFILE_KIND) continue;
+          f(_storage[i].id, _stats[i]);
+          ++n;
+        }
+        return n;
+      }
+
+    private:
+      Slot         _storage[N] = {};
+      Id           _ids[N] = {};
+      uint16_t     _cells[size_t(1) << detail::poolIndexBits(N)] = {};
+      ProfileStats _stats[N] = {};
+    };
+
+    ProfileTable g_profiles;
+
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+    void record(ProfileStats& st, uint32_t us) {
+      __atomic_add_fetch(&st.count, 1, __ATOMIC_RELAXED);
+      __atomic_add_fetch(&st.sumUs, (uint64_t)us, __ATOMIC_RELAXED);
+
+      uint32_t cur = __atomic_load_n(&st.minUs, __ATOMIC_RELAXED);
+      while (us < cur &&
+             !__atomic_compare_exchange_n(&st.minUs, &cur, us, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+
+      cur = __atomic_load_n(&st.maxUs, __ATOMIC_RELAXED);
+      while (us > cur &&
+             !__atomic_compare_exchange_n(&st.maxUs, &cur, us, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+    }
+#else
+    void record(ProfileStats& st, uint32_t us) {
+      ++st.count;
+      st.sumUs += us;
+      if (us < st.minUs) st.minUs = us;
+      if (us > st.maxUs) st.maxUs = us;
+    }
+#endif
+
+    /**
+     * @brief Wall-clock microseconds (code cost is measured in real time,
+     *        even when the engine runs on the virtual clock).
+     */
+    inline uint32_t nowUs() {
+#if defined(ARDUINO)
+      return (uint32_t)micros();
+#else
+      using namespace std::chrono;
+      return (uint32_t)duration_cast<microseconds>(
+        steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+  } // namespace
+
+  // ============================================================================
+  // Profile scope
+  // ============================================================================
+
+  Profile::Profile(Id id) : _id(id), _start(nowUs()) {}
+
+  Profile::~Profile() {
+    const uint32_t us = nowUs() - _start;
+    if (ProfileStats* st = g_profiles.find(_id)) record(*st, us);
+  }
+
+  // ============================================================================
+  // Read-out
+  // ============================================================================
+
+  size_t visitProfiles(ProfileVisitor fn, void* ctx) {
+    if (!fn) return 0;
+    return g_profiles.each([&](Id id, const ProfileStats& st) { fn(id, st, ctx); });
+  }
+
+  void resetProfiles() {
+    g_profiles.each([](Id, ProfileStats& st) { st = ProfileStats{}; });
+  }
+
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+  size_t profileReport(Print& out) {
+    PrintBatch batch(out);
+
+    g_profiles.each([&](Id id, const ProfileStats& st) {
+      batch.hex(id)
+           .text(" n=").number(st.count)
+           .text(" min=").number(st.count ? st.minUs : 0)
+           .text(" avg=").number(st.meanUs())
+           .text(" max=").number(st.maxUs)
+           .text(" us\r\n");
+    });
+
+    return batch.flush();
+  }
+#endif
+
+} // namespace Tempo
+
+#endif // HESTIA_TEMPO_PROFILE
@@ -0,0 +1,128 @@
+#include "HestiaTempo.h"
+
+#if defined(HESTIA_TEMPO_RTC_POOL)
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#error "HESTIA_TEMPO_RTC_POOL requires an ESP32 target"
+#endif
+
+#include <new>
+#include <esp_attr.h>
+#if __has_include(<esp_private/esp_clk.h>)
+#include <esp_private/esp_clk.h>
+#else
+#include <esp32/clk.h>
+#endif
+
+/**
+ * @file    HestiaTempoRtc.cpp
+ * @brief   Deep-sleep persistent slot pool for HestiaTempo (ESP32).
+ *
+ * @details
+ * The pool and the offset between the RTC timer and the engine clock are
+ * kept in RTC slow memory. The engine clock restarts at every boot while
+ * the RTC timer keeps counting through deep sleep, so on the first access
+ * of a boot every running timer is shifted by the change of that offset:
+ *
+ *   start' = start + (offset before sleep - offset now)
+ *
+ * Slot timestamps stay in engine ticks; the rest of the engine needs no
+ * knowledge of the pool.
+ */
+
+namespace Tempo {
+
+  namespace {
+
+    /**
+     * @brief Persistent pool storage (kept off the pool list: its link
+     *        would not survive deep sleep).
+     */
+    class RtcPool : public SlotPool {
+    public:
+      static constexpr size_t N = HESTIA_TEMPO_RTC_SLOTS;
+
+      constexpr RtcPool()
+        : SlotPool(_storage, _extra, _ids, _cells, N, detail::poolIndexBits(N), false) {}
+
+      /**
+       * @brief Shift the running timers and drop per-boot references.
+       */
+      void rebase(Tick shift) {
+        for (size_t i = 0; i < N; ++i) {
+          Slot& s = _storage[i];
+          if (s.kind == Kind::None) continue;   // free: start is a list link
+
+          s.start  += shift;
+          _extra[i] = SlotExtra{};   // handlers and parse cache of the last boot
+#if defined(HESTIA_TEMPO_THREAD_SAFE)
+          s.seq     = 0;
+#endif
+#if defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+          // Expiry falls back to the clock until the next start() arms a
+          // new timer
+          s.timer   = nullptr;
+          s.fired   = 0;
+          s.direct  = false;
+          s.rephase = false;
+#endif
+        }
+      }
+
+    private:
+      Slot      _storage[N] = {};
+      SlotExtra _extra[N] = {};
+      Id        _ids[N] = {};
+      uint16_t  _cells[size_t(1) << detail::poolIndexBits(N)] = {};
+    };
+
+    /**
+     * @brief Layout tag: a firmware with a different pool layout starts
+     *        from an empty pool instead of reading stale fields.
+     */
+    constexpr uint32_t RTC_MAGIC =
+      0x48540000u ^ (uint32_t)(sizeof(RtcPool) << 4) ^ (uint32_t)RtcPool::N;
+
+    struct RtcState {
+      uint32_t magic  = 0;
+      Tick     offset = 0;   ///< RTC ticks minus engine ticks, this boot
+      RtcPool  pool;
+    };
+
+    RTC_DATA_ATTR RtcState g_rtc;
+
+    /** Cleared at every boot (regular RAM). */
+    bool g_restored = false;
+
+    /**
+     * @brief RTC timer in engine ticks (keeps counting in deep sleep).
+     */
+    inline Tick rtcTicks() {
+      return (Tick)(esp_clk_rtc_time() / (1000 / TICKS_PER_MS));
+    }
+
+    void restore() {
+      const Tick offset = rtcTicks() - detail::now();
+
+      if (g_rtc.magic != RTC_MAGIC) {
+        // Power-on or new layout: start empty
+        new (&g_rtc.pool) RtcPool();
+        g_rtc.magic = RTC_MAGIC;
+      } else {
+        g_rtc.pool.rebase((Tick)(g_rtc.offset - offset));
+      }
+
+      g_rtc.offset = offset;
+      g_restored   = true;
+    }
+
+  } // namespace
+
+  SlotPool& rtcPool() {
+    if (!g_restored) restore();
+    return g_rtc.pool;
+  }
+
+} // namespace Tempo
+
+#endif
@@ -0,0 +1,245 @@
+#include "HestiaTempo.h"
+
+/**
+ * @file    HestiaTempoWheel.cpp
+ * @brief   Hierarchical timing wheel for high-volume timeouts.
+ *
+ * @details
+ * Level L holds deadlines that are less than 64^(L+1) ms away, bucketed by
+ * bits [6L, 6L+6) of the deadline. Level-0 buckets expire as wheel time
+ * reaches them; a higher-level bucket is cascaded (its entries placed again,
+ * one level lower or more) when the level below wraps around to it.
+ *
+ * Ids are resolved through the wheel's own slot index (a private, unlisted
+ * SlotPool), so allocation, the Id lookup and Error::SlotTableFull behave
+ * as for any pool. Slot::active marks entries linked into a bucket.
+ */
+
+namespace Tempo {
+
+  namespace {
+
+    /** Bits of the deadline per level. */
+    constexpr unsigned LEVEL_BITS = 6;
+
+    /** Farthest deadline placed directly (64^5 - 1 ms, ~12.4 days). */
+    constexpr uint32_t MAX_SPAN = (uint32_t(1) << (LEVEL_BITS * TimerWheel::LEVELS)) - 1;
+
+    /** Farthest deadline from wheel time the signed compares can tell from the past. */
+    constexpr uint32_t MAX_DELTA = 0x7FFFFFFFu;
+
+    /**
+     * @brief Wheel clock: engine time in milliseconds (wraps like millis()).
+     */
+    inline uint32_t nowMs() {
+      return (uint32_t)(detail::now() / TICKS_PER_MS);
+    }
+
+  } // namespace
+
+  // ============================================================================
+  // Bucket lists
+  // ============================================================================
+
+  /**
+   * @brief Insert an entry into the bucket matching its deadline.
+   *
+   * @details
+   * An entry due now (only possible while cascading) goes to the current
+   * level-0 bucket, which is expired right after the cascade.
+   */
+  void TimerWheel::place(uint16_t pos) {
+    detail::WheelEntry& e = _entries[pos];
+
+    uint32_t delta = ((int32_t)(e.expires - _now) > 0) ? e.expires - _now : 0;
+    uint32_t at    = _now + delta;
+    size_t   level = 0;
+    if (delta >= BUCKETS) {
+      if (delta > MAX_SPAN) {
+        // Too far for the top level: park it at the farthest bucket and
+        // place it again when that bucket cascades
+        delta = MAX_SPAN;
+        at    = _now + delta;
+      }
+      level = (31 - __builtin_clz(delta)) / LEVEL_BITS;
+    }
+
+    const size_t index = (at >> (LEVEL_BITS * level)) & (BUCKETS - 1);
+    const size_t b     = level * BUCKETS + index;
+
+    e.bucket = (uint16_t)b;
+    e.prev   = 0;
+    e.next   = _heads[b];
+    if (e.next) _entries[e.next - 1].prev = pos + 1;
+    _heads[b] = pos + 1;
+    _occupied[level] |= uint64_t(1) << index;
+  }
+
+  void TimerWheel::unlink(uint16_t pos) {
+    detail::WheelEntry& e = _entries[pos];
+
+    if (e.prev) _entries[e.prev - 1].next = e.next;
+    else        _heads[e.bucket] = e.next;
+    if (e.next) _entries[e.next - 1].prev = e.prev;
+
+    if (!_heads[e.bucket]) {
+      _occupied[e.bucket / BUCKETS] &= ~(uint64_t(1) << (e.bucket % BUCKETS));
+    }
+  }
+
+  /**
+   * @brief Cascade the buckets that came due at a level-0 wrap-around.
+   */
+  void TimerWheel::cascade() {
+    for (size_t level = 1; level < LEVELS; ++level) {
+      const size_t index = (_now >> (LEVEL_BITS * level)) & (BUCKETS - 1);
+      const size_t b     = level * BUCKETS + index;
+
+      uint16_t e = _heads[b];
+      _heads[b] = 0;
+      _occupied[level] &= ~(uint64_t(1) << index);
+
+      while (e) {
+        const uint16_t next = _entries[e - 1].next;
+        place(e - 1);
+        e = next;
+      }
+
+      // The next level is only due when this one wrapped as well
+      if (index != 0) break;
+    }
+  }
+
+  size_t TimerWheel::expireBucket(size_t bucket, Handler fn, void* ctx) {
+    size_t fired = 0;
+
+    // Pop from the head each time: the handler may unlink other entries
+    for (uint16_t e; (e = _heads[bucket]) != 0; ) {
+      const uint16_t pos = e - 1;
+      unlink(pos);
+
+      Slot*    s  = slotAt(pos);
+      const Id id = s->id;
+      release(s);   // before the handler, which may start the Id again
+
+      ++fired;
+      if (fn) fn(id, ctx);
+    }
+    return fired;
+  }
+
+  // ============================================================================
+  // Timeouts
+  // ============================================================================
+
+  bool TimerWheel::start(Id id, uint32_t timeout_ms) {
+    const uint32_t now = nowMs();
+    if (used() == 0) _now = now;   // empty wheel: skip the idle stretch
+
+    Slot* s = slot(id, Kind::OneShot);
+    if (!s) return false;
+
+    const uint16_t pos = (uint16_t)position(s);
+    if (s->active) unlink(pos);
+
+    // The deadline is taken from the caller's clock. Wheel time may lag
+    // behind it until the next poll(); the lag is bounded so that the
+    // deadline stays within MAX_DELTA of wheel time (MAX_TIMEOUT_MS leaves
+    // ~4.6 hours of lag headroom), and a deadline never lands in the bucket
+    // being processed
+    const uint32_t timeout = (timeout_ms > MAX_TIMEOUT_MS) ? MAX_TIMEOUT_MS : timeout_ms;
+    const int32_t  behind  = (int32_t)(now - _now);
+    uint32_t       lag     = (behind > 0) ? (uint32_t)behind : 0;
+    if (lag > MAX_DELTA - timeout) lag = MAX_DELTA - timeout;
+
+    const uint32_t span = lag + timeout;
+    _entries[pos].expires = _now + (span ? span : 1);
+    place(pos);
+    s->active = true;
+    return true;
+  }
+
+  bool TimerWheel::cancel(Id id) {
+    Slot* s = slot(id, Kind::OneShot, false);
+    if (!s) return false;
+
+    if (s->active) unlink((uint16_t)position(s));
+    release(s);
+    return true;
+  }
+
+  bool TimerWheel::running(Id id) {
+    return slot(id, Kind::OneShot, false) != nullptr;
+  }
+
+  uint32_t TimerWheel::remaining(Id id) {
+    const Slot* s = slot(id, Kind::OneShot, false);
+    if (!s) return 0;
+
+    const int32_t rem = (int32_t)(_entries[position(s)].expires - nowMs());
+    return (rem > 0) ? (uint32_t)rem : 0;
+  }
+
+  // ============================================================================
+  // Expiry
+  // ============================================================================
+
+  size_t TimerWheel::poll(Handler fn, void* ctx) {
+    const uint32_t t = nowMs();
+    size_t fired = 0;
+
+    while ((int32_t)(t - _now) > 0) {
+      if (used() == 0) {
+        _now = t;
+        break;
+      }
+
+      // Jump to the next occupied level-0 bucket, or to the wrap-around
+      // (where higher levels cascade), whichever comes first
+      const uint32_t c     = _now & (BUCKETS - 1);
+      const uint64_t ahead = (c == BUCKETS - 1) ? 0 : _occupied[0] & (~uint64_t(0) << (c + 1));
+      const uint32_t step  = ahead ? (uint32_t)__builtin_ctzll(ahead) - c
+                                   : (uint32_t)BUCKETS - c;
+
+      if ((uint32_t)(t - _now) < step) {
+        _now = t;
+        break;
+      }
+
+      _now += step;
+      if ((_now & (BUCKETS - 1)) == 0) cascade();
+      fired += expireBucket(_now & (BUCKETS - 1), fn, ctx);
+    }
+    return fired;
+  }
+
+  uint32_t TimerWheel::nextDeadline() const {
+    if (used() == 0) return NO_DEADLINE;
+
+    uint64_t best = ~uint64_t(0);
+    for (size_t level = 0; level < LEVELS; ++level) {
+      const uint64_t occ = _occupied[level];
+      if (!occ) continue;
+
+      // First occupied bucket after the current one, in ring order
+      const unsigned shift = LEVEL_BITS * level;
+      const uint32_t c     = (_now >> shift) & (BUCKETS - 1);
+      const uint64_t after = (c == BUCKETS - 1) ? 0 : occ & (~uint64_t(0) << (c + 1));
+      const uint32_t b     = (uint32_t)__builtin_ctzll(after ? after : occ);
+
+      const uint64_t span = uint64_t(1) << (shift + LEVEL_BITS);
+      const uint64_t base = ((uint64_t)_now >> (shift + LEVEL_BITS)) << (shift + LEVEL_BITS);
+      const uint64_t due  = base + ((uint64_t)b << shift) + (after ? 0 : span);
+
+      if (due - _now < best) best = due - _now;
+    }
+
+    // Wheel time may lag behind the clock until the next poll()
+    const uint32_t lag = nowMs() - _now;
+    if (best <= lag) return 0;
+
+    best -= lag;
+    return (best >= NO_DEADLINE) ? NO_DEADLINE - 1 : (uint32_t)best;
+  }
+
+} // namespace Tempo
@@ -0,0 +1,141 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Interval catch-up policy and overrun counter tests.
+ *
+ * @details
+ * Each test stalls a 100 ms interval for 350 ms (three boundaries passed)
+ * and checks what every() reports afterwards under one policy.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+namespace {
+
+  /**
+   * @brief Call every() until it stops firing; return the number of expiries.
+   */
+  template <typename Timer>
+  int drain(Timer& t, uint32_t period_ms) {
+    int fired = 0;
+    while (t.every(period_ms) && fired < 100) ++fired;
+    return fired;
+  }
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_on_time_has_no_overruns() {
+  Interval t = interval("C_ONTIME"_id);
+  t.every(100);
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_TRUE(t.every(100));
+  TEST_ASSERT_EQUAL_UINT32(0, t.overruns());
+  t.release();
+}
+
+void test_burst_fires_each_missed_period() {
+  Interval t = interval("C_BURST"_id);
+  t.every(100);
+  VirtualClock::advanceMs(350);
+
+  TEST_ASSERT_TRUE(t.every(100));
+  TEST_ASSERT_EQUAL_UINT32(2, t.overruns());   // two expiries still pending
+  TEST_ASSERT_TRUE(t.every(100));
+  TEST_ASSERT_EQUAL_UINT32(1, t.overruns());
+  TEST_ASSERT_TRUE(t.every(100));
+  TEST_ASSERT_EQUAL_UINT32(0, t.overruns());
+  TEST_ASSERT_FALSE(t.every(100));
+
+  TEST_ASSERT_EQUAL_UINT32(50, t.remaining());   // phase kept
+  t.release();
+}
+
+void test_skip_fires_once_and_keeps_phase() {
+  Interval t = interval("C_SKIP"_id);
+  t.catchUp(CatchUp::Skip);
+  t.every(100);
+  VirtualClock::advanceMs(350);
+
+  TEST_ASSERT_EQUAL_INT(1, drain(t, 100));
+  TEST_ASSERT_EQUAL_UINT32(2, t.overruns());     // dropped expiries
+  TEST_ASSERT_EQUAL_UINT32(50, t.remaining());   // next boundary at 400
+
+  VirtualClock::advanceMs(50);
+  TEST_ASSERT_EQUAL_INT(1, drain(t, 100));
+  TEST_ASSERT_EQUAL_UINT32(0, t.overruns());
+  t.release();
+}
+
+void test_coalesce_fires_once_and_restarts_period() {
+  Interval t = interval("C_COALESCE"_id);
+  t.catchUp(CatchUp::Coalesce);
+  t.every(100);
+  VirtualClock::advanceMs(350);
+
+  TEST_ASSERT_EQUAL_INT(1, drain(t, 100));
+  TEST_ASSERT_EQUAL_UINT32(2, t.overruns());
+  TEST_ASSERT_EQUAL_UINT32(100, t.remaining());   // period restarts now
+
+  VirtualClock::advanceMs(99);
+  TEST_ASSERT_FALSE(t.every(100));
+  VirtualClock::advanceMs(1);
+  TEST_ASSERT_TRUE(t.every(100));
+  TEST_ASSERT_EQUAL_UINT32(0, t.overruns());
+  t.release();
+}
+
+void test_policy_applies_to_handles() {
+  IntervalHandle h = bind<Interval>("C_HANDLE"_id);
+  h.catchUp(CatchUp::Skip);
+  h.every(100);
+  VirtualClock::advanceMs(1000);
+
+  TEST_ASSERT_EQUAL_INT(1, drain(h, 100));
+  TEST_ASSERT_EQUAL_UINT32(9, h.overruns());
+  TEST_ASSERT_EQUAL_UINT32(h.overruns(), interval("C_HANDLE"_id).overruns());
+  h.release();
+}
+
+void test_policy_kept_until_release() {
+  Interval t = interval("C_RESET"_id);
+  t.catchUp(CatchUp::Skip);
+  t.every(100);
+  VirtualClock::advanceMs(300);
+  TEST_ASSERT_EQUAL_INT(1, drain(t, 100));
+  VirtualClock::advanceMs(300);     // still Skip on the next stall
+  TEST_ASSERT_EQUAL_INT(1, drain(t, 100));
+
+  t.release();                      // release restores Burst
+  t.every(100);
+  VirtualClock::advanceMs(300);
+  TEST_ASSERT_EQUAL_INT(3, drain(t, 100));
+  t.release();
+}
+
+void test_overruns_saturate() {
+  Interval t = interval("C_SATURATE"_id);
+  t.catchUp(CatchUp::Skip);
+  t.every(1);
+  VirtualClock::advanceMs(100000);
+  TEST_ASSERT_TRUE(t.every(1));
+  TEST_ASSERT_EQUAL_UINT32(0xFFFF, t.overruns());
+  t.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_on_time_has_no_overruns);
+  RUN_TEST(test_burst_fires_each_missed_period);
+  RUN_TEST(test_skip_fires_once_and_keeps_phase);
+  RUN_TEST(test_coalesce_fires_once_and_restarts_period);
+  RUN_TEST(test_policy_applies_to_handles);
+  RUN_TEST(test_policy_kept_until_release);
+  RUN_TEST(test_overruns_saturate);
+  return UNITY_END();
+}
@@ -0,0 +1,98 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Clock policy tests (virtual clock, wrap-around of engine time).
+ *
+ * @details
+ * The host build runs on clocks::Virtual, so the clock can be placed just
+ * before the wrap of Tick and every timer kind checked across it.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+namespace {
+
+  /** Engine time `ms` milliseconds before Tick wraps to 0. */
+  Tick beforeWrap(uint32_t ms) { return (Tick)0 - (Tick)ms * TICKS_PER_MS; }
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_host_build_uses_the_virtual_clock() {
+  static_assert(Clock::simulated, "host builds run on a simulated clock");
+
+  VirtualClock::set(1234 * TICKS_PER_MS);
+  TEST_ASSERT_TRUE(VirtualClock::now() == 1234 * TICKS_PER_MS);
+  TEST_ASSERT_TRUE(detail::now() == VirtualClock::now());
+
+  VirtualClock::advance(TICKS_PER_MS);
+  VirtualClock::advanceMs(5);
+  TEST_ASSERT_TRUE(detail::now() == 1240 * TICKS_PER_MS);
+}
+
+void test_oneshot_across_the_wrap() {
+  VirtualClock::set(beforeWrap(30));
+  OneShot t = oneShot("K_ONESHOT"_id);
+  t.start(100);
+
+  VirtualClock::advanceMs(60);    // wrapped
+  TEST_ASSERT_TRUE(t.running());
+  TEST_ASSERT_EQUAL_UINT32(60, t.elapsed());
+  TEST_ASSERT_EQUAL_UINT32(40, t.remaining());
+  TEST_ASSERT_EQUAL_UINT32(40, nextDeadline());
+
+  VirtualClock::advanceMs(40);
+  TEST_ASSERT_TRUE(t.done());
+  t.release();
+}
+
+void test_interval_across_the_wrap() {
+  VirtualClock::set(beforeWrap(250));
+  Interval t = interval("K_INTERVAL"_id);
+  t.every(100);
+
+  int fired = 0;
+  for (int ms = 0; ms < 1000; ++ms) {
+    VirtualClock::advanceMs(1);
+    if (t.every(100)) ++fired;
+  }
+  TEST_ASSERT_EQUAL_INT(10, fired);
+  TEST_ASSERT_EQUAL_UINT32(0, t.overruns());
+  t.release();
+}
+
+void test_group_across_the_wrap() {
+  static Group<2> g;
+  VirtualClock::set(beforeWrap(5));
+  g.start(0, 10);
+  VirtualClock::advanceMs(9);
+  TEST_ASSERT_EQUAL_HEX32(0, g.expired());
+  VirtualClock::advanceMs(1);
+  TEST_ASSERT_EQUAL_HEX32(0x01, g.expired());
+  g.cancelAll();
+}
+
+void test_idle_is_not_scaled() {
+  // HESTIA_TEMPO_CLOCK_SCALE speeds up real clocks only
+  OneShot t = oneShot("K_IDLE"_id);
+  t.start(500);
+  const Tick t0 = VirtualClock::now();
+  idle();
+  TEST_ASSERT_TRUE(VirtualClock::now() - t0 == (Tick)500 * TICKS_PER_MS);
+  t.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_host_build_uses_the_virtual_clock);
+  RUN_TEST(test_oneshot_across_the_wrap);
+  RUN_TEST(test_interval_across_the_wrap);
+  RUN_TEST(test_group_across_the_wrap);
+  RUN_TEST(test_idle_is_not_scaled);
+  return UNITY_END();
+}
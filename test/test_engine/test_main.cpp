@@ -0,0 +1,147 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Host regression tests for the HestiaTempo engine.
+ *
+ * @details
+ * Run by the PlatformIO `native` environments (`pio test -e native`, and
+ * `pio test -e native_scaled` to check that HESTIA_TEMPO_CLOCK_SCALE leaves
+ * the virtual clock alone). The engine runs on Tempo::VirtualClock, so every
+ * expectation is exact.
+ *
+ * All tests share the default pool: each one uses its own Ids and releases
+ * its timers before returning, so nextDeadline() only sees its own.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// Interval
+// ============================================================================
+
+void test_every_fires_once_per_period() {
+  Interval t = interval("T_EVERY"_id);
+
+  TEST_ASSERT_FALSE(t.every(100));   // first call arms the timer
+
+  VirtualClock::advanceMs(99);
+  TEST_ASSERT_FALSE(t.every(100));
+  VirtualClock::advanceMs(1);
+  TEST_ASSERT_TRUE(t.every(100));
+  TEST_ASSERT_FALSE(t.every(100));
+
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_TRUE(t.every(100));
+
+  t.release();
+}
+
+// ============================================================================
+// OneShot
+// ============================================================================
+
+void test_done_after_duration() {
+  OneShot t = oneShot("T_DONE"_id);
+
+  t.start(50);
+  VirtualClock::advanceMs(49);
+  TEST_ASSERT_TRUE(t.running());
+  TEST_ASSERT_FALSE(t.done());
+
+  VirtualClock::advanceMs(1);
+  TEST_ASSERT_TRUE(t.done());
+  TEST_ASSERT_TRUE(t.done());        // Release::Keep: stays done
+
+  t.release();
+}
+
+void test_release_on_done_frees_slot() {
+  const size_t before = defaultPool().used();
+  OneShot t = oneShot("T_ONDONE"_id);
+
+  t.start(10, Release::OnDone);
+  TEST_ASSERT_EQUAL_UINT32(before + 1, defaultPool().used());
+
+  VirtualClock::advanceMs(10);
+  TEST_ASSERT_TRUE(t.done());
+  TEST_ASSERT_EQUAL_UINT32(before, defaultPool().used());
+  TEST_ASSERT_FALSE(t.done());
+  TEST_ASSERT_FALSE(t.running());
+}
+
+// ============================================================================
+// Idle support
+// ============================================================================
+
+void test_next_deadline() {
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());
+
+  OneShot t = oneShot("T_DEADLINE"_id);
+  t.start(250);
+  TEST_ASSERT_EQUAL_UINT32(250, nextDeadline());
+
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_EQUAL_UINT32(150, nextDeadline());
+
+  VirtualClock::advanceMs(200);
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());   // expired: nothing pending
+  t.release();
+
+  // An overdue Interval is due right now
+  Interval i = interval("T_DEADLINE_IV"_id);
+  i.every(100);
+  VirtualClock::advanceMs(150);
+  TEST_ASSERT_EQUAL_UINT32(0, nextDeadline());
+
+  i.release();
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());
+}
+
+void test_idle_advances_virtual_clock() {
+  OneShot t = oneShot("T_IDLE"_id);
+  t.start(300);
+
+  const Tick t0 = VirtualClock::now();
+  TEST_ASSERT_EQUAL_UINT32(100, idle(100));   // bounded wait
+  TEST_ASSERT_EQUAL_UINT32(200, idle());      // up to the deadline
+  TEST_ASSERT_TRUE(VirtualClock::now() - t0 == (Tick)300 * TICKS_PER_MS);
+  TEST_ASSERT_TRUE(t.done());
+  TEST_ASSERT_EQUAL_UINT32(0, idle());        // already due
+
+  t.release();
+  TEST_ASSERT_EQUAL_UINT32(0, idle());        // nothing pending, no bound
+}
+
+void test_idle_paces_interval() {
+  Interval t = interval("T_PACE"_id);
+  t.every(100);
+
+  // One idle() per period must yield exactly one expiry per period, with
+  // or without HESTIA_TEMPO_CLOCK_SCALE
+  int fired = 0;
+  for (int i = 0; i < 10; ++i) {
+    idle(100);
+    if (t.every(100)) ++fired;
+  }
+  TEST_ASSERT_EQUAL_INT(10, fired);
+  TEST_ASSERT_EQUAL_UINT32(100, t.remaining());
+
+  t.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_fires_once_per_period);
+  RUN_TEST(test_done_after_duration);
+  RUN_TEST(test_release_on_done_frees_slot);
+  RUN_TEST(test_next_deadline);
+  RUN_TEST(test_idle_advances_virtual_clock);
+  RUN_TEST(test_idle_paces_interval);
+  return UNITY_END();
+}
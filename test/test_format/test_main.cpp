@@ -0,0 +1,145 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Digit-table formatter tests, checked against snprintf.
+ *
+ * @details
+ * The reference strings come from the snprintf formats the formatter
+ * replaced, so any divergence in padding, rounding or truncation shows up
+ * here. The formatter does not exist with HESTIA_TEMPO_MINIMAL.
+ */
+
+#include <unity.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "HestiaTempo.h"
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+#include "HestiaTempoFormat.h"
+#endif
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+namespace {
+
+  /**
+   * @brief What the snprintf-based formatter wrote for `ms`.
+   */
+  int reference(uint32_t ms, char* out, size_t len, Format fmt) {
+    const unsigned long total   = ms / 1000UL;
+    const unsigned long seconds = total % 60UL;
+    const unsigned long minutes = (total / 60UL) % 60UL;
+    const unsigned long hours   = total / 3600UL;
+
+    switch (fmt) {
+      case Format::HMS_MS:
+        return snprintf(out, len, "%02lu:%02lu:%02lu.%03lu",
+                        hours, minutes, seconds, (unsigned long)(ms % 1000UL));
+      case Format::HMS:
+        return snprintf(out, len, "%02lu:%02lu:%02lu", hours, minutes, seconds);
+      case Format::MS:
+        return snprintf(out, len, "%lu", (unsigned long)ms);
+      case Format::AUTO_SHORT:
+      default:
+        if (ms < 1000UL)  return snprintf(out, len, "%lu ms", (unsigned long)ms);
+        if (ms < 60000UL) return snprintf(out, len, "%lu sec", (unsigned long)(ms / 1000UL));
+        return snprintf(out, len, "%lu min", (unsigned long)(ms / 60000UL));
+    }
+  }
+
+  const Format FORMATS[] = { Format::HMS_MS, Format::HMS, Format::MS, Format::AUTO_SHORT };
+
+  /**
+   * @brief Compare both formatters for one value, every format.
+   */
+  void check(uint32_t ms) {
+    for (Format fmt : FORMATS) {
+      char want[32];
+      char got[FORMAT_BUFFER_SIZE];
+      const int n = reference(ms, want, sizeof(want), fmt);
+
+      TEST_ASSERT_TRUE(n > 0 && (size_t)n < sizeof(got));
+      TEST_ASSERT_EQUAL_size_t((size_t)n, HestiaTempoFormat::format(ms, got, sizeof(got), fmt));
+      TEST_ASSERT_EQUAL_STRING(want, got);
+    }
+  }
+
+} // namespace
+
+void test_matches_snprintf_at_boundaries() {
+  const uint32_t values[] = {
+    0, 1, 9, 10, 99, 100, 999, 1000, 1001, 9999, 59999, 60000, 60001,
+    599999, 3599999, 3600000, 35999999, 36000000, 359999999, 360000000,
+    0x7FFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFFu,
+  };
+  for (uint32_t v : values) check(v);
+}
+
+void test_matches_snprintf_sweep() {
+  // Every digit count and carry pattern of the two-digit table
+  uint32_t v = 1;
+  for (int i = 0; i < 2000; ++i) {
+    check(v);
+    v = v * 2654435761u + 12345u;   // Knuth multiplicative step
+  }
+  for (uint32_t p = 1; p <= 1000000000u; p *= 10) {
+    check(p - 1);
+    check(p);
+    check(p + 1);
+  }
+}
+
+void test_truncates_like_snprintf() {
+  for (Format fmt : FORMATS) {
+    for (size_t len = 1; len <= FORMAT_BUFFER_SIZE; ++len) {
+      char want[32];
+      char got[FORMAT_BUFFER_SIZE + 1];
+      memset(got, 'x', sizeof(got));
+
+      const int    full = reference(4000000000u, want, len, fmt);
+      const size_t n    = HestiaTempoFormat::format(4000000000u, got, len, fmt);
+
+      TEST_ASSERT_EQUAL_STRING(want, got);
+      TEST_ASSERT_EQUAL_size_t(strlen(want), n);   // characters actually written
+      TEST_ASSERT_TRUE(n <= (size_t)full);
+      TEST_ASSERT_EQUAL_INT('x', got[len]);        // nothing past the buffer
+    }
+  }
+
+  char one = 'x';
+  TEST_ASSERT_EQUAL_size_t(0, HestiaTempoFormat::format(1234, &one, 0, Format::MS));
+  TEST_ASSERT_EQUAL_INT('x', one);
+  TEST_ASSERT_EQUAL_size_t(0, HestiaTempoFormat::format(1234, nullptr, 8, Format::MS));
+}
+
+void test_timer_strings() {
+  OneShot t = oneShot("F_TIMER"_id);
+  t.start(3512);
+  VirtualClock::advanceMs(1000);
+
+  char buf[FORMAT_BUFFER_SIZE];
+  TEST_ASSERT_EQUAL_size_t(12, remainingStr("F_TIMER"_id, buf, sizeof(buf), Format::HMS_MS));
+  TEST_ASSERT_EQUAL_STRING("00:00:02.512", buf);
+  TEST_ASSERT_EQUAL_size_t(4, elapsedStr("F_TIMER"_id, buf, sizeof(buf), Format::MS));
+  TEST_ASSERT_EQUAL_STRING("1000", buf);
+  TEST_ASSERT_EQUAL_STRING("2 sec", remainingStr("F_TIMER"_id));
+
+  t.release();
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_matches_snprintf_at_boundaries);
+  RUN_TEST(test_matches_snprintf_sweep);
+  RUN_TEST(test_truncates_like_snprintf);
+  RUN_TEST(test_timer_strings);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,77 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Frame timestamp tests (beginFrame() / endFrame()).
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() { endFrame(); }
+
+void test_begin_frame_latches_the_clock() {
+  VirtualClock::advanceMs(5);
+  const Tick latched = beginFrame();
+  TEST_ASSERT_TRUE(latched == VirtualClock::now());
+
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_TRUE(detail::now() == latched);
+
+  endFrame();
+  TEST_ASSERT_TRUE(detail::now() == VirtualClock::now());
+}
+
+void test_timers_share_the_frame_time() {
+  OneShot a = oneShot("F_A"_id);
+  OneShot b = oneShot("F_B"_id);
+  a.start(10);
+  b.start(10);
+
+  beginFrame();
+  VirtualClock::advanceMs(10);    // expires mid-frame: not visible yet
+  TEST_ASSERT_FALSE(a.done());
+  TEST_ASSERT_FALSE(b.done());
+  TEST_ASSERT_EQUAL_UINT32(10, a.remaining());
+
+  beginFrame();                   // next iteration
+  TEST_ASSERT_TRUE(a.done());
+  TEST_ASSERT_TRUE(b.done());
+  a.release();
+  b.release();
+}
+
+void test_start_inside_a_frame_uses_the_frame_time() {
+  beginFrame();
+  VirtualClock::advanceMs(7);     // work done since the frame began
+  OneShot t = oneShot("F_START"_id);
+  t.start(50);
+  endFrame();
+
+  TEST_ASSERT_EQUAL_UINT32(43, t.remaining());
+  t.release();
+}
+
+void test_interval_in_frames() {
+  Interval t = interval("F_EVERY"_id);
+  int fired = 0;
+  for (int i = 0; i < 20; ++i) {
+    beginFrame();
+    if (t.every(50)) ++fired;
+    if (t.every(50)) ++fired;     // same frame, same answer after firing
+    VirtualClock::advanceMs(25);
+  }
+  TEST_ASSERT_EQUAL_INT(9, fired);   // 475 ms elapsed at the last frame
+  t.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_begin_frame_latches_the_clock);
+  RUN_TEST(test_timers_share_the_frame_time);
+  RUN_TEST(test_start_inside_a_frame_uses_the_frame_time);
+  RUN_TEST(test_interval_in_frames);
+  return UNITY_END();
+}
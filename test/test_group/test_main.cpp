@@ -0,0 +1,103 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::Group<N> tests (expired bitmask and per-member queries).
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() { endFrame(); }
+
+void test_expired_bitmask() {
+  static Group<8> g;
+  g.start(0, 100);
+  g.start(3, 50);
+  g.start(7, 200);
+  TEST_ASSERT_EQUAL_HEX32(0x89, g.active());
+  TEST_ASSERT_EQUAL_HEX32(0, g.expired());
+
+  VirtualClock::advanceMs(50);
+  TEST_ASSERT_EQUAL_HEX32(0x08, g.expired());
+
+  VirtualClock::advanceMs(50);
+  TEST_ASSERT_EQUAL_HEX32(0x09, g.expired());
+
+  g.cancel(3);
+  TEST_ASSERT_EQUAL_HEX32(0x01, g.expired());
+  TEST_ASSERT_EQUAL_HEX32(0x81, g.active());
+
+  g.cancelAll();
+  TEST_ASSERT_EQUAL_HEX32(0, g.active());
+  TEST_ASSERT_EQUAL_HEX32(0, g.expired());
+}
+
+void test_member_queries_match_expired() {
+  static Group<4> g;
+  g.start(1, 30);
+  TEST_ASSERT_TRUE(g.running(1));
+  TEST_ASSERT_FALSE(g.done(1));
+  TEST_ASSERT_FALSE(g.running(0));   // never started
+  TEST_ASSERT_FALSE(g.done(0));
+  TEST_ASSERT_EQUAL_UINT32(30, g.remaining(1));
+
+  VirtualClock::advanceMs(30);
+  TEST_ASSERT_FALSE(g.running(1));
+  TEST_ASSERT_TRUE(g.done(1));
+  TEST_ASSERT_TRUE(g.done(1));       // stays done until restarted
+  TEST_ASSERT_EQUAL_UINT32(0, g.remaining(1));
+
+  g.restart(1);
+  TEST_ASSERT_TRUE(g.running(1));
+  TEST_ASSERT_FALSE(g.done(1));
+
+  g.cancel(1);
+  TEST_ASSERT_FALSE(g.running(1));
+  TEST_ASSERT_FALSE(g.done(1));
+
+  // Out-of-range indices are ignored
+  g.start(4, 10);
+  TEST_ASSERT_EQUAL_HEX32(0, g.active());
+  TEST_ASSERT_FALSE(g.done(4));
+}
+
+void test_member_queries_use_frame_timestamp() {
+  static Group<2> g;
+  g.start(0, 10);
+
+  beginFrame();
+  VirtualClock::advanceMs(10);
+  TEST_ASSERT_FALSE(g.done(0));      // frame time is still the start time
+  TEST_ASSERT_EQUAL_HEX32(0, g.expired());
+  endFrame();
+
+  TEST_ASSERT_TRUE(g.done(0));
+  TEST_ASSERT_EQUAL_HEX32(0x01, g.expired());
+}
+
+void test_next_deadline() {
+  static Group<4> g;
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, g.nextDeadline());
+
+  g.start(0, 300);
+  g.start(2, 120);
+  TEST_ASSERT_EQUAL_UINT32(120, g.nextDeadline());
+
+  VirtualClock::advanceMs(150);
+  TEST_ASSERT_EQUAL_UINT32(0, g.nextDeadline());
+
+  g.cancel(2);
+  TEST_ASSERT_EQUAL_UINT32(150, g.nextDeadline());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_expired_bitmask);
+  RUN_TEST(test_member_queries_match_expired);
+  RUN_TEST(test_member_queries_use_frame_timestamp);
+  RUN_TEST(test_next_deadline);
+  return UNITY_END();
+}
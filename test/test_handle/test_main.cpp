@@ -0,0 +1,139 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Cached handle tests (binding, revalidation after slot reuse).
+ *
+ * @details
+ * A one-slot pool makes slot reuse deterministic: once a handle's slot is
+ * released, the next timer of the pool lands in the same storage.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+void test_handle_shares_state_with_facade() {
+  OneShotHandle h = bind<OneShot>("H_SHARED"_id);
+  TEST_ASSERT_EQUAL_HEX32("H_SHARED"_id, h.id());
+
+  h.start(100);
+  TEST_ASSERT_TRUE(oneShot("H_SHARED"_id).running());
+  VirtualClock::advanceMs(40);
+  TEST_ASSERT_EQUAL_UINT32(60, oneShot("H_SHARED"_id).remaining());
+  TEST_ASSERT_EQUAL_UINT32(40, h.elapsed());
+
+  oneShot("H_SHARED"_id).cancel();
+  TEST_ASSERT_FALSE(h.running());
+  h.release();
+}
+
+void test_binding_allocates_queries_do_not() {
+  static Pool<2> pool;
+  OneShotHandle h(pool, "H_LAZY"_id);   // bound (and allocated) here
+  TEST_ASSERT_EQUAL_size_t(1, pool.used());
+  TEST_ASSERT_FALSE(h.running());
+
+  h.release();
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+  TEST_ASSERT_FALSE(h.running());       // released: queries do not rebind
+  TEST_ASSERT_EQUAL_UINT32(0, h.remaining());
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+
+  h.start(10);
+  TEST_ASSERT_EQUAL_size_t(1, pool.used());
+  h.release();
+}
+
+void test_rebinds_after_release() {
+  static Pool<1> pool;
+  IntervalHandle h(pool, "H_REBIND"_id);
+  h.every(100);
+  h.release();
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+
+  TEST_ASSERT_FALSE(h.every(50));   // new slot, armed again
+  TEST_ASSERT_EQUAL_UINT32(50, h.remaining());
+  TEST_ASSERT_EQUAL_size_t(1, pool.used());
+  h.release();
+}
+
+void test_reused_slot_is_not_followed() {
+  static Pool<1> pool;
+  OneShotHandle h(pool, "H_OWNER"_id);
+  h.start(100);
+
+  OneShot(pool, "H_OWNER"_id).release();   // slot freed behind the handle
+  OneShot other(pool, "H_OTHER"_id);
+  other.start(500);                        // ... and reused by another Id
+
+  // The handle sees the slot is no longer its own: no access to H_OTHER
+  TEST_ASSERT_FALSE(h.running());
+  TEST_ASSERT_EQUAL_UINT32(0, h.remaining());
+  h.cancel();
+  TEST_ASSERT_TRUE(other.running());
+  TEST_ASSERT_EQUAL_UINT32(500, other.remaining());
+
+  h.start(10);   // pool full: rejected, H_OTHER untouched
+  TEST_ASSERT_FALSE(h.running());
+  TEST_ASSERT_EQUAL_UINT32(500, other.remaining());
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  TEST_ASSERT_TRUE(lastError() == Error::SlotTableFull);
+#endif
+
+  other.release();
+  h.start(10);   // binding retried on the next call
+  TEST_ASSERT_TRUE(h.running());
+  h.release();
+}
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+/**
+ * @brief Overwrite the last error with one no handle operation records.
+ */
+static void resetError() {
+  const uint32_t ms = "not a duration"_hms;   // records InvalidFormat
+  (void)ms;
+}
+
+void test_slot_reused_with_another_kind() {
+  static Pool<1> pool;
+  OneShotHandle h(pool, "H_KIND"_id);
+  h.start(100);
+  h.release();
+
+  Interval(pool, "H_KIND"_id).every(100);   // same Id, now an Interval
+  resetError();
+  h.remaining();                            // revalidation finds the new kind
+  TEST_ASSERT_TRUE(lastError() == Error::IdKindMismatch);
+  Interval(pool, "H_KIND"_id).release();
+}
+
+void test_kind_mismatch_on_bind() {
+  interval("H_MISMATCH"_id).every(100);
+  resetError();
+  OneShotHandle h = bind<OneShot>("H_MISMATCH"_id);
+  TEST_ASSERT_TRUE(lastError() == Error::IdKindMismatch);
+
+  resetError();
+  h.running();                              // reported on every use
+  TEST_ASSERT_TRUE(lastError() == Error::IdKindMismatch);
+  interval("H_MISMATCH"_id).release();
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_handle_shares_state_with_facade);
+  RUN_TEST(test_binding_allocates_queries_do_not);
+  RUN_TEST(test_rebinds_after_release);
+  RUN_TEST(test_reused_slot_is_not_followed);
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_slot_reused_with_another_kind);
+  RUN_TEST(test_kind_mismatch_on_bind);
+#endif
+  return UNITY_END();
+}
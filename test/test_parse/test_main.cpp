@@ -0,0 +1,132 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Duration parser tests (parseDuration, "_hms", parseHMS).
+ *
+ * @details
+ * The accepted forms are also checked in constant expressions, so a
+ * regression in the constexpr path fails the build rather than the run.
+ */
+
+#include <unity.h>
+
+#include <string.h>
+
+#include "HestiaTempo.h"
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+#include "HestiaTempoFormat.h"
+#endif
+
+using namespace Tempo;
+
+static_assert("00:00:05"_hms == 5000, "HH:MM:SS");
+static_assert("01:02:03.5"_hms == 3723500, "HH:MM:SS.m");
+static_assert("250ms"_hms == 250, "ms unit");
+static_assert("1.5s"_hms == 1500, "fractional seconds");
+static_assert("2m"_hms == 120000, "minutes");
+static_assert("1h"_hms == 3600000, "hours");
+
+namespace {
+
+  bool parse(const char* s, uint32_t& ms, bool strict = false) {
+    return detail::parseDuration(s, strlen(s), ms, strict);
+  }
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_accepted_forms() {
+  struct Case { const char* s; uint32_t ms; };
+  const Case cases[] = {
+    { "00:00:00",      0 },
+    { "00:00:59",      59000 },
+    { "100:00:00",     360000000 },
+    { "00:00:01.1",    1100 },
+    { "00:00:01.01",   1010 },
+    { "00:00:01.001",  1001 },
+    { "0ms",           0 },
+    { "4294967295ms",  0xFFFFFFFFu },
+    { "0.25s",         250 },
+    { "1.0005s",       1000 },   // below the millisecond: truncated
+    { "0.5m",          30000 },
+    { "1.25h",         4500000 },
+  };
+
+  for (const Case& c : cases) {
+    uint32_t ms = 1234;
+    TEST_ASSERT_TRUE(parse(c.s, ms));
+    TEST_ASSERT_EQUAL_UINT32(c.ms, ms);
+  }
+}
+
+void test_rejected_forms() {
+  const char* bad[] = {
+    "", "ms", "10", "10x", "10 ms", " 10ms", "10ms ", "1.s", ".5s", "-1s",
+    "1:2:3", "01:02", "01:60:00", "01:00:60", "00:00:01.", "00:00:01.1234",
+    "00:00:01x", "4294967296ms", "1194h", "99999999999s",
+  };
+
+  for (const char* s : bad) {
+    uint32_t ms = 1234;
+    TEST_ASSERT_FALSE(parse(s, ms));
+    TEST_ASSERT_EQUAL_UINT32(1234, ms);   // untouched on failure
+  }
+}
+
+void test_length_bound_and_nul() {
+  uint32_t ms = 0;
+  TEST_ASSERT_TRUE(detail::parseDuration("250msXYZ", 5, ms));
+  TEST_ASSERT_EQUAL_UINT32(250, ms);
+  TEST_ASSERT_FALSE(detail::parseDuration("250ms", 3, ms));
+  TEST_ASSERT_TRUE(detail::parseDuration("1s\0xx", 5, ms));   // stops at NUL
+  TEST_ASSERT_EQUAL_UINT32(1000, ms);
+  TEST_ASSERT_FALSE(detail::parseDuration(nullptr, 4, ms));
+}
+
+void test_strict_accepts_hms_only() {
+  uint32_t ms = 0;
+  TEST_ASSERT_TRUE(parse("12:34:56", ms, true));
+  TEST_ASSERT_EQUAL_UINT32(45296000, ms);
+  TEST_ASSERT_FALSE(parse("12:34:56.7", ms, true));
+  TEST_ASSERT_FALSE(parse("250ms", ms, true));
+}
+
+void test_malformed_literal_at_run_time() {
+  // Not constant-evaluated: compiles, never fires
+  const uint32_t ms = "1:2"_hms;
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, ms);
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  TEST_ASSERT_TRUE(lastError() == Error::InvalidFormat);
+#endif
+}
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+void test_parse_hms_rejects() {
+  uint32_t ms = 0;
+  TEST_ASSERT_TRUE(HestiaTempoFormat::parseHMS("01:02:03", ms));
+  TEST_ASSERT_EQUAL_UINT32(3723000, ms);
+
+  // The examples rejected by the parseHMS() documentation
+  const char* bad[] = { "1:2:3", "01:02", "10s", "01:02:03.5", "01:02:03 " };
+  for (const char* s : bad) {
+    ms = 1234;
+    TEST_ASSERT_FALSE(HestiaTempoFormat::parseHMS(s, ms));
+    TEST_ASSERT_EQUAL_UINT32(1234, ms);
+  }
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_accepted_forms);
+  RUN_TEST(test_rejected_forms);
+  RUN_TEST(test_length_bound_and_nul);
+  RUN_TEST(test_strict_accepts_hms_only);
+  RUN_TEST(test_malformed_literal_at_run_time);
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_parse_hms_rejects);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,110 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Per-slot duration string cache, for every kind of slot owner.
+ *
+ * @details
+ * The cache is keyed by the string's address, so rewriting a buffer in
+ * place and passing it again reveals whether the call was served from the
+ * cache (old value) or parsed (new value).
+ */
+
+#include <unity.h>
+
+#include <string.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+using AppTimers = Registry<
+  IntervalTimer<"R_BLINK"_id>,
+  OneShotTimer<"R_TIMEOUT"_id>
+>;
+
+static OneShotArray<2> g_relays("T_RELAY"_id);
+
+void test_facade_serves_repeated_literal_from_cache() {
+  char buf[] = "100ms";
+  oneShot("T_FACADE"_id).start(buf);
+  TEST_ASSERT_EQUAL_UINT32(100, oneShot("T_FACADE"_id).remaining());
+
+  strcpy(buf, "900ms");
+  oneShot("T_FACADE"_id).start(buf);
+  TEST_ASSERT_EQUAL_UINT32(100, oneShot("T_FACADE"_id).remaining());
+
+  const char* other = "300ms";   // another address: parsed
+  oneShot("T_FACADE"_id).start(other);
+  TEST_ASSERT_EQUAL_UINT32(300, oneShot("T_FACADE"_id).remaining());
+
+  oneShot("T_FACADE"_id).release();
+}
+
+void test_pool_handle_uses_cache() {
+  OneShotHandle h = bind<OneShot>("T_HANDLE"_id);
+  char buf[] = "00:00:01";
+  h.start(buf);
+  strcpy(buf, "00:00:09");
+  h.start(buf);
+  TEST_ASSERT_EQUAL_UINT32(1000, h.remaining());
+  h.release();
+}
+
+void test_registry_handles_use_cache() {
+  char buf[] = "200ms";
+  AppTimers::oneShot<"R_TIMEOUT"_id>().start(buf);
+  strcpy(buf, "700ms");
+  AppTimers::oneShot<"R_TIMEOUT"_id>().start(buf);
+  TEST_ASSERT_EQUAL_UINT32(200, AppTimers::oneShot<"R_TIMEOUT"_id>().remaining());
+
+  char period[] = "50ms";
+  IntervalHandle blink = AppTimers::interval<"R_BLINK"_id>();
+  TEST_ASSERT_FALSE(blink.every(period));
+  strcpy(period, "10ms");
+  VirtualClock::advanceMs(10);
+  TEST_ASSERT_FALSE(blink.every(period));   // still the cached 50 ms
+  VirtualClock::advanceMs(40);
+  TEST_ASSERT_TRUE(blink.every(period));
+
+  AppTimers::oneShot<"R_TIMEOUT"_id>().cancel();
+}
+
+void test_array_members_have_separate_caches() {
+  char a[] = "40ms";
+  char b[] = "80ms";
+  g_relays[0].start(a);
+  g_relays[1].start(b);
+  strcpy(a, "99ms");
+  g_relays[0].start(a);
+  g_relays[1].start(a);   // member 1 has not seen this address yet
+
+  TEST_ASSERT_EQUAL_UINT32(40, g_relays[0].remaining());
+  TEST_ASSERT_EQUAL_UINT32(99, g_relays[1].remaining());
+}
+
+void test_invalid_string_is_rejected() {
+  OneShot t = oneShot("T_INVALID"_id);
+  t.start("12x");
+  TEST_ASSERT_TRUE(lastError() == Error::InvalidFormat);
+  TEST_ASSERT_FALSE(t.running());
+
+  TEST_ASSERT_FALSE(AppTimers::interval<"R_BLINK"_id>().every("oops"));
+  TEST_ASSERT_TRUE(lastError() == Error::InvalidFormat);
+}
+
+#endif // !HESTIA_TEMPO_MINIMAL
+
+int main() {
+  UNITY_BEGIN();
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_facade_serves_repeated_literal_from_cache);
+  RUN_TEST(test_pool_handle_uses_cache);
+  RUN_TEST(test_registry_handles_use_cache);
+  RUN_TEST(test_array_members_have_separate_caches);
+  RUN_TEST(test_invalid_string_is_rejected);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,105 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Phase::Spread tests (Id-derived first deadline, later periods).
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+namespace {
+
+  const Id IDS[] = { "P_TEMP"_id, "P_HUMIDITY"_id, "P_PRESSURE"_id, "P_LIGHT"_id,
+                     "P_CO2"_id,  "P_VOC"_id,      "P_NOISE"_id,    "P_DUST"_id };
+  constexpr size_t COUNT = sizeof(IDS) / sizeof(IDS[0]);
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_aligned_is_one_full_period() {
+  Interval t = interval("P_ALIGNED"_id);
+  TEST_ASSERT_FALSE(t.every(1000, Phase::Aligned));
+  TEST_ASSERT_EQUAL_UINT32(1000, t.remaining());
+  t.release();
+}
+
+void test_spread_staggers_first_deadlines() {
+  uint32_t first[COUNT];
+  for (size_t i = 0; i < COUNT; ++i) {
+    Interval t = interval(IDS[i]);
+    TEST_ASSERT_FALSE(t.every(1000, Phase::Spread));
+    first[i] = t.remaining();
+    TEST_ASSERT_TRUE(first[i] > 0 && first[i] <= 1000);
+  }
+
+  size_t distinct = 0;
+  for (size_t i = 0; i < COUNT; ++i) {
+    bool unique = true;
+    for (size_t j = 0; j < i; ++j) unique &= (first[j] != first[i]);
+    distinct += unique;
+  }
+  TEST_ASSERT_EQUAL_size_t(COUNT, distinct);
+
+  // Each one fires exactly at its own offset, then once per period
+  for (size_t i = 0; i < COUNT; ++i) {
+    Interval t = interval(IDS[i]);
+    t.release();                       // restart from now
+    t.every(1000, Phase::Spread);
+    VirtualClock::advanceMs(first[i] - 1);
+    TEST_ASSERT_FALSE(t.every(1000, Phase::Spread));
+    VirtualClock::advanceMs(1);
+    TEST_ASSERT_TRUE(t.every(1000, Phase::Spread));
+    TEST_ASSERT_EQUAL_UINT32(1000, t.remaining());
+    t.release();
+  }
+}
+
+void test_offset_depends_on_id_only() {
+  static Pool<2> poolA;
+  static Pool<2> poolB;
+  Interval a(poolA, "P_SAME"_id);
+  a.every(500, Phase::Spread);
+  const uint32_t offset = a.remaining();
+
+  VirtualClock::advanceMs(123);   // another pool, another start time
+  Interval b(poolB, "P_SAME"_id);
+  b.every(500, Phase::Spread);
+  TEST_ASSERT_EQUAL_UINT32(offset, b.remaining());
+  a.release();
+  b.release();
+}
+
+void test_phase_only_applies_on_first_call() {
+  Interval t = interval("P_FIRST"_id);
+  t.every(100);
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_TRUE(t.every(100, Phase::Spread));   // already running
+  TEST_ASSERT_EQUAL_UINT32(100, t.remaining());
+  t.release();
+}
+
+void test_spread_on_handles() {
+  IntervalHandle h = bind<Interval>(IDS[0]);
+  h.every(1000, Phase::Spread);
+  const uint32_t viaHandle = h.remaining();
+  h.release();
+
+  Interval t = interval(IDS[0]);
+  t.every(1000, Phase::Spread);
+  TEST_ASSERT_EQUAL_UINT32(viaHandle, t.remaining());
+  t.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_aligned_is_one_full_period);
+  RUN_TEST(test_spread_staggers_first_deadlines);
+  RUN_TEST(test_offset_depends_on_id_only);
+  RUN_TEST(test_phase_only_applies_on_first_call);
+  RUN_TEST(test_spread_on_handles);
+  return UNITY_END();
+}
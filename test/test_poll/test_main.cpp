@@ -0,0 +1,163 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::poll() dispatch tests (handlers, context, self-release).
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+namespace {
+
+  struct Calls {
+    Id     last;
+    void*  ctx;
+    size_t n;
+  };
+
+  Calls g_calls;
+
+  void count(Id id, void* ctx) {
+    g_calls.last = id;
+    g_calls.ctx  = ctx;
+    ++g_calls.n;
+  }
+
+} // namespace
+
+void setUp() { g_calls = Calls{}; }
+void tearDown() {}
+
+void test_interval_handler_once_per_period() {
+  int tag = 0;
+  Interval t = interval("D_TICK"_id);
+  t.onEvery(100, count, &tag);
+
+  TEST_ASSERT_EQUAL_size_t(0, poll());
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_HEX32("D_TICK"_id, g_calls.last);
+  TEST_ASSERT_EQUAL_PTR(&tag, g_calls.ctx);
+  TEST_ASSERT_EQUAL_size_t(0, poll());          // consumed
+
+  // A stall catches up one period per poll(), like every()
+  VirtualClock::advanceMs(300);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_size_t(0, poll());
+  TEST_ASSERT_EQUAL_size_t(4, g_calls.n);
+
+  t.release();                                  // unregisters the handler
+  VirtualClock::advanceMs(1000);
+  TEST_ASSERT_EQUAL_size_t(0, poll());
+}
+
+void test_oneshot_handler_once_per_start() {
+  OneShot t = oneShot("D_ONCE"_id);
+  t.onDone(count);
+  VirtualClock::advanceMs(1000);
+  TEST_ASSERT_EQUAL_size_t(0, poll());          // registration does not start
+
+  t.start(50);
+  VirtualClock::advanceMs(50);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_FALSE(t.done());                  // expiry consumed by poll()
+  TEST_ASSERT_EQUAL_size_t(0, poll());
+
+  t.restart();
+  VirtualClock::advanceMs(50);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_size_t(2, g_calls.n);
+  t.release();
+}
+
+void test_timers_without_handler_untouched() {
+  OneShot plain = oneShot("D_PLAIN"_id);
+  OneShot hooked = oneShot("D_HOOKED"_id);
+  hooked.onDone(count);
+  plain.start(10);
+  hooked.start(10);
+  VirtualClock::advanceMs(10);
+
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_TRUE(plain.done());               // still observable by polling
+  plain.release();
+  hooked.release();
+}
+
+void test_release_on_done_after_dispatch() {
+  const size_t before = defaultPool().used();
+  OneShot t = oneShot("D_TRANSIENT"_id);
+  t.onDone(count);
+  t.start(20, Release::OnDone);
+  TEST_ASSERT_EQUAL_size_t(before + 1, defaultPool().used());
+
+  VirtualClock::advanceMs(20);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_size_t(before, defaultPool().used());
+}
+
+void test_handler_releases_itself() {
+  static Pool<2> pool;
+  static size_t  calls = 0;
+  Interval t(pool, "D_SELF"_id);
+  t.onEvery(10, [](Id id, void* p) {
+    ++calls;
+    Interval(*static_cast<SlotPool*>(p), id).release();
+  }, &pool);
+
+  VirtualClock::advanceMs(10);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+  VirtualClock::advanceMs(10);
+  TEST_ASSERT_EQUAL_size_t(0, poll());
+  TEST_ASSERT_EQUAL_size_t(1, calls);
+}
+
+void test_handler_restarts_itself() {
+  static size_t calls = 0;
+  OneShot t = oneShot("D_RESTART"_id);
+  t.onDone([](Id id, void*) {
+    if (++calls < 3) oneShot(id).start(10);
+  });
+  t.start(10);
+
+  for (int i = 0; i < 10; ++i) {
+    VirtualClock::advanceMs(10);
+    poll();
+  }
+  TEST_ASSERT_EQUAL_size_t(3, calls);
+  TEST_ASSERT_FALSE(t.running());
+  t.release();
+}
+
+void test_handler_releasing_another_timer() {
+  static Pool<3> pool;
+  Interval a(pool, "D_A"_id);
+  Interval b(pool, "D_B"_id);
+  a.onEvery(10, [](Id, void* p) {
+    Interval(*static_cast<SlotPool*>(p), "D_B"_id).release();
+  }, &pool);
+  b.onEvery(10, count);
+
+  VirtualClock::advanceMs(10);
+  poll();
+  TEST_ASSERT_EQUAL_size_t(1, pool.used());     // b released before its turn
+  TEST_ASSERT_EQUAL_size_t(0, g_calls.n);
+  a.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_interval_handler_once_per_period);
+  RUN_TEST(test_oneshot_handler_once_per_start);
+  RUN_TEST(test_timers_without_handler_untouched);
+  RUN_TEST(test_release_on_done_after_dispatch);
+  RUN_TEST(test_handler_releases_itself);
+  RUN_TEST(test_handler_restarts_itself);
+  RUN_TEST(test_handler_releasing_another_timer);
+  return UNITY_END();
+}
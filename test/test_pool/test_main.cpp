@@ -0,0 +1,99 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::Pool tests (isolation, exhaustion, coverage by the engine).
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+void test_capacity_and_default_pool() {
+  static Pool<3> pool;
+  TEST_ASSERT_EQUAL_size_t(3, pool.capacity());
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+  TEST_ASSERT_EQUAL_size_t(HESTIA_TEMPO_MAX_SLOTS, defaultPool().capacity());
+}
+
+void test_same_id_in_two_pools_is_two_timers() {
+  static Pool<2> a;
+  static Pool<2> b;
+  a.oneShot("O_SHARED"_id).start(100);
+  b.oneShot("O_SHARED"_id).start(300);
+
+  TEST_ASSERT_EQUAL_UINT32(100, a.oneShot("O_SHARED"_id).remaining());
+  TEST_ASSERT_EQUAL_UINT32(300, b.oneShot("O_SHARED"_id).remaining());
+  TEST_ASSERT_FALSE(oneShot("O_SHARED"_id).running());   // nor the default pool
+
+  a.oneShot("O_SHARED"_id).release();
+  TEST_ASSERT_TRUE(b.oneShot("O_SHARED"_id).running());
+  b.oneShot("O_SHARED"_id).release();
+}
+
+void test_exhausting_one_pool_spares_the_others() {
+  static Pool<2> small;
+  static Pool<2> other;
+  small.oneShot("O_1"_id).start(10);
+  small.oneShot("O_2"_id).start(10);
+
+  small.oneShot("O_3"_id).start(10);
+  TEST_ASSERT_FALSE(small.oneShot("O_3"_id).running());
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  TEST_ASSERT_TRUE(lastError() == Error::SlotTableFull);
+#endif
+  TEST_ASSERT_EQUAL_size_t(2, small.used());
+
+  other.oneShot("O_3"_id).start(10);
+  TEST_ASSERT_TRUE(other.oneShot("O_3"_id).running());
+  oneShot("O_3"_id).start(10);
+  TEST_ASSERT_TRUE(oneShot("O_3"_id).running());
+
+  small.oneShot("O_1"_id).release();
+  small.oneShot("O_2"_id).release();
+  other.oneShot("O_3"_id).release();
+  oneShot("O_3"_id).release();
+}
+
+void test_engine_covers_every_pool() {
+  static Pool<4> pool;
+  static int     fired = 0;
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());
+
+  pool.oneShot("O_DEADLINE"_id).start(70);
+  oneShot("O_DEFAULT"_id).start(90);
+  TEST_ASSERT_EQUAL_UINT32(70, nextDeadline());
+
+  pool.interval("O_POLL"_id).onEvery(50, [](Id, void*) { ++fired; });
+  TEST_ASSERT_EQUAL_UINT32(50, nextDeadline());
+  VirtualClock::advanceMs(50);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+  TEST_ASSERT_EQUAL_INT(1, fired);
+
+  pool.oneShot("O_DEADLINE"_id).release();
+  pool.interval("O_POLL"_id).release();
+  TEST_ASSERT_EQUAL_UINT32(40, nextDeadline());
+  oneShot("O_DEFAULT"_id).release();
+}
+
+void test_pool_handles_and_facades_agree() {
+  static Pool<2> pool;
+  IntervalHandle h = pool.bind<Interval>("O_HANDLE"_id);
+  h.every(100);
+  TEST_ASSERT_EQUAL_UINT32(100, pool.interval("O_HANDLE"_id).remaining());
+  TEST_ASSERT_EQUAL_UINT32(0, interval("O_HANDLE"_id).remaining());
+  h.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_capacity_and_default_pool);
+  RUN_TEST(test_same_id_in_two_pools_is_two_timers);
+  RUN_TEST(test_exhausting_one_pool_spares_the_others);
+  RUN_TEST(test_engine_covers_every_pool);
+  RUN_TEST(test_pool_handles_and_facades_agree);
+  return UNITY_END();
+}
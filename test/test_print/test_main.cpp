@@ -0,0 +1,132 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Print sink tests (printRemaining(), PrintBatch).
+ *
+ * @details
+ * The Print layer exists on Arduino builds only. The recording sink counts
+ * write() calls, so the tests check that output reaches it in blocks.
+ */
+
+#include <unity.h>
+
+#include <string.h>
+
+#include "HestiaTempo.h"
+
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+#include <Arduino.h>
+#endif
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+namespace {
+
+  /**
+   * @brief Print sink keeping its output and its write() calls.
+   */
+  class RecordingPrint : public Print {
+  public:
+    char   text[256] = {};
+    size_t len      = 0;
+    size_t writes   = 0;     ///< Block writes
+    size_t largest  = 0;     ///< Largest block
+    size_t bytes    = 0;     ///< Single-byte writes
+    size_t accept   = 256;   ///< Bytes accepted per block (short writes)
+
+    size_t write(uint8_t c) override {
+      ++bytes;
+      return append(&c, 1);
+    }
+
+    size_t write(const uint8_t* b, size_t n) override {
+      ++writes;
+      if (n > largest) largest = n;
+      return append(b, n < accept ? n : accept);
+    }
+
+  private:
+    size_t append(const uint8_t* b, size_t n) {
+      if (len + n >= sizeof(text)) n = sizeof(text) - 1 - len;
+      memcpy(text + len, b, n);
+      len += n;
+      return n;
+    }
+  };
+
+} // namespace
+
+void test_print_remaining_is_one_write() {
+  OneShot t = oneShot("W_TIMEOUT"_id);
+  t.start(3512);
+  VirtualClock::advanceMs(1000);
+
+  RecordingPrint out;
+  TEST_ASSERT_EQUAL_size_t(12, printRemaining(out, "W_TIMEOUT"_id, Format::HMS_MS));
+  TEST_ASSERT_EQUAL_size_t(4, printElapsed(out, "W_TIMEOUT"_id, Format::MS));
+  TEST_ASSERT_EQUAL_STRING("00:00:02.5121000", out.text);
+  TEST_ASSERT_EQUAL_size_t(2, out.writes);
+  TEST_ASSERT_EQUAL_size_t(0, out.bytes);
+  t.release();
+}
+
+void test_batch_writes_once() {
+  OneShot t = oneShot("W_BATCH"_id);
+  t.start(90000);
+  VirtualClock::advanceMs(30000);
+
+  RecordingPrint out;
+  {
+    PrintBatch batch(out);
+    batch.text("left=").remaining("W_BATCH"_id, Format::HMS)
+      .text(" up=").elapsed("W_BATCH"_id)
+      .text(" n=").number(42)
+      .text(" id=").hex(0xBEEFu);
+    TEST_ASSERT_EQUAL_size_t(0, out.writes);     // nothing until destroyed
+  }
+  TEST_ASSERT_EQUAL_STRING("left=00:01:00 up=30 sec n=42 id=0000beef", out.text);
+  TEST_ASSERT_EQUAL_size_t(1, out.writes);
+  t.release();
+}
+
+void test_long_batch_is_split_in_blocks() {
+  RecordingPrint out;
+  PrintBatch batch(out);
+  char expected[201] = {};
+  for (int i = 0; i < 20; ++i) {
+    batch.text("0123456789");
+    strcat(expected, "0123456789");
+  }
+  TEST_ASSERT_EQUAL_size_t(200, batch.flush());
+  TEST_ASSERT_EQUAL_STRING(expected, out.text);
+  TEST_ASSERT_TRUE(out.writes >= 200 / PrintBatch::CAPACITY);
+  TEST_ASSERT_TRUE(out.largest <= PrintBatch::CAPACITY);
+  TEST_ASSERT_EQUAL_size_t(0, out.bytes);
+
+  TEST_ASSERT_EQUAL_size_t(200, batch.flush());   // nothing pending
+}
+
+void test_flush_reports_accepted_bytes() {
+  RecordingPrint out;
+  out.accept = 3;                                  // sink takes 3 bytes per write
+  PrintBatch batch(out);
+  batch.text("abcdef");
+  TEST_ASSERT_EQUAL_size_t(3, batch.flush());
+  batch.text(nullptr);                             // ignored
+  TEST_ASSERT_EQUAL_size_t(3, batch.flush());
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_print_remaining_is_one_write);
+  RUN_TEST(test_batch_writes_once);
+  RUN_TEST(test_long_batch_is_split_in_blocks);
+  RUN_TEST(test_flush_reports_accepted_bytes);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,128 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Code-section profiler tests (HESTIA_TEMPO_PROFILE).
+ *
+ * @details
+ * Run by `pio test -e native_instrumented`. Sections are timed in real
+ * time, not on the virtual clock, so the tests check counts and ordering
+ * rather than exact durations.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+#if defined(HESTIA_TEMPO_PROFILE)
+#include <chrono>
+#endif
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+#if defined(HESTIA_TEMPO_PROFILE)
+namespace {
+
+  /** Spin for at least `us` microseconds of real time. */
+  void spin(uint32_t us) {
+    using namespace std::chrono;
+    const auto until = steady_clock::now() + microseconds(us);
+    while (steady_clock::now() < until) {}
+  }
+
+  /** Copy of the record of one section, found by visitProfiles(). */
+  struct Found {
+    Id           id;
+    ProfileStats stats;
+    bool         seen;
+  };
+
+  void find(Id id, const ProfileStats& st, void* ctx) {
+    Found& f = *static_cast<Found*>(ctx);
+    if (id == f.id) {
+      f.stats = st;
+      f.seen  = true;
+    }
+  }
+
+  void ignore(Id, const ProfileStats&, void*) {}
+
+  Found lookup(Id id) {
+    Found f = { id, {}, false };
+    visitProfiles(find, &f);
+    return f;
+  }
+
+} // namespace
+
+void test_scope_is_recorded() {
+  for (int i = 0; i < 3; ++i) {
+    TEMPO_PROFILE("P_SPIN"_id);
+    spin(200 * (i + 1));
+  }
+
+  const Found f = lookup("P_SPIN"_id);
+  TEST_ASSERT_TRUE(f.seen);
+  TEST_ASSERT_EQUAL_UINT32(3, f.stats.count);
+  TEST_ASSERT_TRUE(f.stats.minUs >= 200);
+  TEST_ASSERT_TRUE(f.stats.maxUs >= 600);
+  TEST_ASSERT_TRUE(f.stats.minUs <= f.stats.meanUs());
+  TEST_ASSERT_TRUE(f.stats.meanUs() <= f.stats.maxUs);
+  TEST_ASSERT_TRUE(f.stats.sumUs >= 1200);
+}
+
+void test_longer_section_costs_more() {
+  { TEMPO_PROFILE("P_SHORT"_id); }
+  { TEMPO_PROFILE("P_LONG"_id); spin(2000); }
+
+  TEST_ASSERT_TRUE(lookup("P_LONG"_id).stats.meanUs() >
+                   lookup("P_SHORT"_id).stats.meanUs());
+}
+
+void test_profiler_stays_off_the_engine() {
+  { TEMPO_PROFILE("P_HIDDEN"_id); }
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());
+  TEST_ASSERT_EQUAL_size_t(0, poll());
+}
+
+void test_reset_clears_records() {
+  { TEMPO_PROFILE("P_RESET"_id); }
+  resetProfiles();
+
+  const Found f = lookup("P_RESET"_id);
+  TEST_ASSERT_TRUE(f.seen);                     // the section keeps its entry
+  TEST_ASSERT_EQUAL_UINT32(0, f.stats.count);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, f.stats.minUs);
+  TEST_ASSERT_EQUAL_UINT32(0, f.stats.meanUs());
+
+  { TEMPO_PROFILE("P_RESET"_id); }
+  TEST_ASSERT_EQUAL_UINT32(1, lookup("P_RESET"_id).stats.count);
+}
+
+void test_full_table_drops_new_sections() {
+  // Fill the table with distinct Ids, then one more
+  for (Id id = 0x50000000u; visitProfiles(ignore) < HESTIA_TEMPO_PROFILE_SLOTS; ++id) {
+    Profile p(id);
+  }
+  { Profile p(0x5FFFFFFFu); }
+
+  TEST_ASSERT_FALSE(lookup(0x5FFFFFFFu).seen);
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  TEST_ASSERT_TRUE(lastError() == Error::SlotTableFull);
+#endif
+  TEST_ASSERT_EQUAL_size_t(HESTIA_TEMPO_PROFILE_SLOTS, visitProfiles(ignore));
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+#if defined(HESTIA_TEMPO_PROFILE)
+  RUN_TEST(test_scope_is_recorded);
+  RUN_TEST(test_longer_section_costs_more);
+  RUN_TEST(test_profiler_stays_off_the_engine);
+  RUN_TEST(test_reset_clears_records);
+  RUN_TEST(test_full_table_drops_new_sections);
+#endif
+  return UNITY_END();
+}
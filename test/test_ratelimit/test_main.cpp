@@ -0,0 +1,114 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::RateLimit tests (burst, refill, wait time, slot reuse).
+ *
+ * @details
+ * RateLimit does not exist with HESTIA_TEMPO_MINIMAL.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+void test_new_limiter_allows_a_burst() {
+  RateLimit r = rateLimit("RL_BURST"_id);
+  for (int i = 0; i < 3; ++i) TEST_ASSERT_TRUE(r.allow(5, 3));
+  TEST_ASSERT_FALSE(r.allow(5, 3));
+  r.release();
+}
+
+void test_refill_and_next_token() {
+  RateLimit r = rateLimit("RL_REFILL"_id);
+  TEST_ASSERT_TRUE(r.allow(5, 1));   // 5/s: one token per 200 ms
+  TEST_ASSERT_FALSE(r.allow(5, 1));
+  TEST_ASSERT_EQUAL_UINT32(200, r.nextToken());
+
+  VirtualClock::advanceMs(199);
+  TEST_ASSERT_EQUAL_UINT32(1, r.nextToken());
+  TEST_ASSERT_FALSE(r.allow(5, 1));
+
+  VirtualClock::advanceMs(1);
+  TEST_ASSERT_EQUAL_UINT32(0, r.nextToken());
+  TEST_ASSERT_TRUE(r.allow(5, 1));
+  r.release();
+}
+
+void test_fractional_rate_has_no_rounding_loss() {
+  RateLimit r = rateLimit("RL_FRACTION"_id);
+  for (int i = 0; i < 3; ++i) TEST_ASSERT_TRUE(r.allow(3, 3));
+  TEST_ASSERT_FALSE(r.allow(3, 3));
+
+  // 3 tokens/s, one token every 333.3 ms: polling every ms must not drift
+  int granted = 0;
+  for (int ms = 0; ms < 3000; ++ms) {
+    VirtualClock::advanceMs(1);
+    if (r.allow(3, 3)) ++granted;
+  }
+  TEST_ASSERT_EQUAL_INT(9, granted);
+  r.release();
+}
+
+void test_idle_refill_caps_at_burst() {
+  RateLimit r = rateLimit("RL_CAP"_id);
+  TEST_ASSERT_TRUE(r.allow(100, 2));
+  TEST_ASSERT_TRUE(r.allow(100, 2));
+  TEST_ASSERT_FALSE(r.allow(100, 2));
+
+  VirtualClock::advanceMs(60000);
+  TEST_ASSERT_TRUE(r.allow(100, 2));
+  TEST_ASSERT_TRUE(r.allow(100, 2));
+  TEST_ASSERT_FALSE(r.allow(100, 2));
+  r.release();
+}
+
+void test_zero_rate_never_refills() {
+  RateLimit r = rateLimit("RL_ZERO"_id);
+  TEST_ASSERT_TRUE(r.allow(0, 1));
+  TEST_ASSERT_FALSE(r.allow(0, 1));
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, r.nextToken());
+
+  r.reset();   // refilled on the next allow()
+  TEST_ASSERT_TRUE(r.allow(0, 1));
+  r.release();
+}
+
+void test_kind_mismatch_is_reported() {
+  interval("RL_SHARED"_id).every(100);
+  TEST_ASSERT_FALSE(rateLimit("RL_SHARED"_id).allow(1, 1));
+  TEST_ASSERT_TRUE(lastError() == Error::IdKindMismatch);
+  interval("RL_SHARED"_id).release();
+}
+
+void test_released_bucket_leaves_no_parse_cache_behind() {
+  static Pool<1> pool;
+  RateLimit r(pool, "RL_REUSE"_id);
+  TEST_ASSERT_TRUE(r.allow(250, 1));   // the rate shares storage with the cache
+  r.release();
+
+  OneShot t(pool, "RL_NEXT"_id);   // reuses the same slot
+  t.start("250ms");
+  TEST_ASSERT_EQUAL_UINT32(250, t.remaining());
+  t.start("00:00:02");
+  TEST_ASSERT_EQUAL_UINT32(2000, t.remaining());
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_new_limiter_allows_a_burst);
+  RUN_TEST(test_refill_and_next_token);
+  RUN_TEST(test_fractional_rate_has_no_rounding_loss);
+  RUN_TEST(test_idle_refill_caps_at_burst);
+  RUN_TEST(test_zero_rate_never_refills);
+  RUN_TEST(test_kind_mismatch_is_reported);
+  RUN_TEST(test_released_bucket_leaves_no_parse_cache_behind);
+#endif
+  return UNITY_END();
+}
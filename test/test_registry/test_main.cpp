@@ -0,0 +1,105 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::Registry tests (static indices, declaration checks, slots).
+ *
+ * @details
+ * The declaration errors Registry rejects with static_assert are checked on
+ * the detail predicates directly, since a failing static_assert cannot be
+ * part of a build that runs.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+using AppTimers = Registry<
+  IntervalTimer<"G_HEARTBEAT"_id>,
+  OneShotTimer<"G_WATCHDOG"_id>,
+  OneShotTimer<"G_DEBOUNCE"_id>
+>;
+
+static_assert(AppTimers::size == 3, "declared timers");
+static_assert(AppTimers::indexOf<"G_HEARTBEAT"_id>() == 0, "declaration order");
+static_assert(AppTimers::indexOf<"G_DEBOUNCE"_id>() == 2, "declaration order");
+
+// Declaration checks behind the Registry static_asserts
+static_assert(detail::registryKindConflict<IntervalTimer<1>, OneShotTimer<1>>(),
+              "same Id, different kinds");
+static_assert(!detail::registryKindConflict<IntervalTimer<1>, OneShotTimer<2>>(),
+              "distinct Ids");
+static_assert(detail::registryDuplicate<OneShotTimer<7>, IntervalTimer<8>, OneShotTimer<7>>(),
+              "repeated declaration");
+static_assert(detail::registryKind<2, IntervalTimer<1>, OneShotTimer<2>>() == Kind::OneShot,
+              "declared kind");
+static_assert(detail::registryKind<3, IntervalTimer<1>, OneShotTimer<2>>() == Kind::None,
+              "undeclared Id");
+
+void setUp() {}
+void tearDown() {
+  AppTimers::interval<"G_HEARTBEAT"_id>().release();
+  AppTimers::oneShot<"G_WATCHDOG"_id>().cancel();
+  AppTimers::oneShot<"G_DEBOUNCE"_id>().cancel();
+}
+
+void test_handles_drive_static_slots() {
+  IntervalHandle hb = AppTimers::interval<"G_HEARTBEAT"_id>();
+  TEST_ASSERT_EQUAL_HEX32("G_HEARTBEAT"_id, hb.id());
+
+  TEST_ASSERT_FALSE(hb.every(100));
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_TRUE(hb.every(100));
+
+  OneShotHandle wd = AppTimers::oneShot<"G_WATCHDOG"_id>();
+  wd.start(50);
+  TEST_ASSERT_TRUE(AppTimers::oneShot<"G_WATCHDOG"_id>().running());   // same slot
+  VirtualClock::advanceMs(50);
+  TEST_ASSERT_TRUE(AppTimers::oneShot<"G_WATCHDOG"_id>().done());
+}
+
+void test_independent_from_runtime_pools() {
+  const size_t before = defaultPool().used();
+  AppTimers::oneShot<"G_WATCHDOG"_id>().start(100);
+  TEST_ASSERT_EQUAL_size_t(before, defaultPool().used());
+
+  // The same Id in the default pool is another timer
+  TEST_ASSERT_FALSE(oneShot("G_WATCHDOG"_id).running());
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());
+  TEST_ASSERT_EQUAL_UINT32(100, AppTimers::nextDeadline());
+}
+
+void test_next_deadline_over_registry() {
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, AppTimers::nextDeadline());
+
+  AppTimers::oneShot<"G_WATCHDOG"_id>().start(300);
+  AppTimers::oneShot<"G_DEBOUNCE"_id>().start(40);
+  AppTimers::interval<"G_HEARTBEAT"_id>().every(100);
+  TEST_ASSERT_EQUAL_UINT32(40, AppTimers::nextDeadline());
+
+  VirtualClock::advanceMs(40);   // expired OneShot: no longer pending
+  TEST_ASSERT_EQUAL_UINT32(60, AppTimers::nextDeadline());
+
+  AppTimers::interval<"G_HEARTBEAT"_id>().release();
+  TEST_ASSERT_EQUAL_UINT32(260, AppTimers::nextDeadline());
+}
+
+void test_release_keeps_the_slot_declared() {
+  OneShotHandle d = AppTimers::oneShot<"G_DEBOUNCE"_id>();
+  d.start(10);
+  d.release();                   // registry slots stay bound to their Id
+  TEST_ASSERT_FALSE(d.running());
+
+  d.start(20);
+  TEST_ASSERT_TRUE(d.running());
+  TEST_ASSERT_EQUAL_UINT32(20, d.remaining());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_handles_drive_static_slots);
+  RUN_TEST(test_independent_from_runtime_pools);
+  RUN_TEST(test_next_deadline_over_registry);
+  RUN_TEST(test_release_keeps_the_slot_declared);
+  return UNITY_END();
+}
@@ -0,0 +1,99 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Slot release and reclamation tests (release(), Release::OnDone).
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+void test_release_returns_the_slot() {
+  static Pool<2> pool;
+  Interval  i = pool.interval("L_INTERVAL"_id);
+  OneShot   o = pool.oneShot("L_ONESHOT"_id);
+  i.every(100);
+  o.start(100);
+  TEST_ASSERT_EQUAL_size_t(2, pool.used());
+
+  i.release();
+  o.release();
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+  TEST_ASSERT_FALSE(o.running());
+  TEST_ASSERT_EQUAL_UINT32(0, i.remaining());
+
+  o.release();                    // already released: no effect
+  pool.oneShot("L_NEVER"_id).release();
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+}
+
+void test_released_timer_starts_afresh() {
+  static Pool<1> pool;
+  Interval t = pool.interval("L_FRESH"_id);
+  t.catchUp(CatchUp::Skip);
+  t.every(100);
+  VirtualClock::advanceMs(250);
+  t.every(100);
+  TEST_ASSERT_EQUAL_UINT32(1, t.overruns());
+
+  t.release();
+  TEST_ASSERT_FALSE(t.every(40));                 // first call arms again
+  TEST_ASSERT_EQUAL_UINT32(40, t.remaining());
+  TEST_ASSERT_EQUAL_UINT32(0, t.overruns());
+  t.release();
+}
+
+void test_runtime_ids_recycle_a_small_pool() {
+  static Pool<4> pool;
+
+  // Far more short-lived timers than slots, one per "request"
+  for (Id req = 0; req < 100; ++req) {
+    pool.oneShot("L_REQ"_id + req).start(5, Release::OnDone);
+    if (req % 4 == 3) {
+      VirtualClock::advanceMs(5);
+      for (Id k = req - 3; k <= req; ++k) {
+        TEST_ASSERT_TRUE(pool.oneShot("L_REQ"_id + k).done());
+      }
+      TEST_ASSERT_EQUAL_size_t(0, pool.used());
+    }
+  }
+}
+
+void test_on_done_keeps_the_slot_while_pending() {
+  static Pool<1> pool;
+  OneShot t = pool.oneShot("L_PENDING"_id);
+  t.start(30, Release::OnDone);
+  VirtualClock::advanceMs(29);
+  TEST_ASSERT_FALSE(t.done());
+  TEST_ASSERT_EQUAL_size_t(1, pool.used());
+
+  // Restarting with Release::Keep makes the timer persistent again
+  t.start(30);
+  VirtualClock::advanceMs(30);
+  TEST_ASSERT_TRUE(t.done());
+  TEST_ASSERT_TRUE(t.done());
+  TEST_ASSERT_EQUAL_size_t(1, pool.used());
+  t.release();
+}
+
+void test_released_pool_leaves_the_engine() {
+  static Pool<1> pool;
+  pool.oneShot("L_LAST"_id).start(10);
+  TEST_ASSERT_EQUAL_UINT32(10, nextDeadline());
+  pool.oneShot("L_LAST"_id).release();
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_release_returns_the_slot);
+  RUN_TEST(test_released_timer_starts_afresh);
+  RUN_TEST(test_runtime_ids_recycle_a_small_pool);
+  RUN_TEST(test_on_done_keeps_the_slot_while_pending);
+  RUN_TEST(test_released_pool_leaves_the_engine);
+  return UNITY_END();
+}
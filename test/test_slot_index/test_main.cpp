@@ -0,0 +1,135 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Hashed slot index tests (collisions, backward-shift deletion).
+ *
+ * @details
+ * Colliding Ids are searched with the index's home function (Fibonacci
+ * hashing of the Id), so clusters are built on purpose, including one that
+ * wraps around the end of the index.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+namespace {
+
+  constexpr uint8_t POOL_BITS = detail::poolIndexBits(8);   // Pool<8>: 16 cells
+
+  size_t home(Id id) { return (uint32_t)(id * 0x9E3779B1u) >> (32 - POOL_BITS); }
+
+  /**
+   * @brief First `n` Ids (from `from`) whose home cell is `cell`.
+   */
+  void colliding(size_t cell, Id* out, size_t n, Id from = 1) {
+    for (Id id = from; n; ++id) {
+      if (home(id) == cell) {
+        *out++ = id;
+        --n;
+      }
+    }
+  }
+
+  /**
+   * @brief Start OneShot i of `ids` with duration base + i.
+   */
+  void startAll(SlotPool& pool, const Id* ids, size_t n, uint32_t base) {
+    for (size_t i = 0; i < n; ++i) pool.oneShot(ids[i]).start(base + (uint32_t)i);
+  }
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_colliding_ids_stay_distinct() {
+  static Pool<8> pool;
+  Id ids[5];
+  colliding(3, ids, 5);
+  startAll(pool, ids, 5, 100);
+  TEST_ASSERT_EQUAL_size_t(5, pool.used());
+
+  for (size_t i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_UINT32(100 + i, pool.oneShot(ids[i]).remaining());
+  }
+  for (size_t i = 0; i < 5; ++i) pool.oneShot(ids[i]).release();
+  TEST_ASSERT_EQUAL_size_t(0, pool.used());
+}
+
+void test_deleting_cluster_members_keeps_others_reachable() {
+  static Pool<8> pool;
+  Id ids[4];
+  colliding(7, ids, 4);
+
+  // Remove each position of the cluster in turn: head, middle, tail
+  for (size_t gone = 0; gone < 4; ++gone) {
+    startAll(pool, ids, 4, 200);
+    pool.oneShot(ids[gone]).release();
+    TEST_ASSERT_EQUAL_size_t(3, pool.used());
+
+    for (size_t i = 0; i < 4; ++i) {
+      if (i == gone) {
+        TEST_ASSERT_FALSE(pool.oneShot(ids[i]).running());
+        continue;
+      }
+      TEST_ASSERT_EQUAL_UINT32(200 + i, pool.oneShot(ids[i]).remaining());
+    }
+    TEST_ASSERT_EQUAL_size_t(3, pool.used());   // lookups did not allocate
+    for (size_t i = 0; i < 4; ++i) pool.oneShot(ids[i]).release();
+  }
+}
+
+void test_cluster_wrapping_around_the_index() {
+  static Pool<8> pool;
+  Id last[3];
+  Id first[2];
+  colliding((size_t(1) << POOL_BITS) - 1, last, 3);   // spills into cells 0, 1
+  colliding(0, first, 2);                             // shifted behind them
+
+  startAll(pool, last, 3, 300);
+  startAll(pool, first, 2, 400);
+  pool.oneShot(last[0]).release();   // entries move back across the wrap
+  pool.oneShot(last[1]).release();
+
+  TEST_ASSERT_EQUAL_UINT32(302, pool.oneShot(last[2]).remaining());
+  TEST_ASSERT_EQUAL_UINT32(400, pool.oneShot(first[0]).remaining());
+  TEST_ASSERT_EQUAL_UINT32(401, pool.oneShot(first[1]).remaining());
+  TEST_ASSERT_EQUAL_size_t(3, pool.used());
+
+  pool.oneShot(last[2]).release();
+  pool.oneShot(first[0]).release();
+  pool.oneShot(first[1]).release();
+}
+
+void test_churn_on_a_full_pool() {
+  static Pool<8> pool;
+  Id ids[8];
+  colliding(5, ids, 4);
+  colliding(6, ids + 4, 4, 1000);
+  startAll(pool, ids, 8, 10);
+  TEST_ASSERT_FALSE(pool.interval("X_EXTRA"_id).every(10));   // full
+  TEST_ASSERT_EQUAL_size_t(8, pool.used());
+
+  // Release and re-insert members in a scrambled order
+  for (size_t round = 0; round < 16; ++round) {
+    const size_t k = (round * 5) % 8;
+    pool.oneShot(ids[k]).release();
+    pool.oneShot(ids[k]).start(10 + (uint32_t)k);
+    for (size_t i = 0; i < 8; ++i) {
+      TEST_ASSERT_EQUAL_UINT32(10 + i, pool.oneShot(ids[i]).remaining());
+    }
+  }
+  TEST_ASSERT_EQUAL_size_t(8, pool.used());
+  for (size_t i = 0; i < 8; ++i) pool.oneShot(ids[i]).release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_colliding_ids_stay_distinct);
+  RUN_TEST(test_deleting_cluster_members_keeps_others_reachable);
+  RUN_TEST(test_cluster_wrapping_around_the_index);
+  RUN_TEST(test_churn_on_a_full_pool);
+  return UNITY_END();
+}
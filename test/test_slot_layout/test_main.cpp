@@ -0,0 +1,67 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Slot layout tests (per-timer memory footprint).
+ *
+ * @details
+ * The sizes are checked exactly for the default options only; the opt-in
+ * fields (HESTIA_TEMPO_STATS, HESTIA_TEMPO_THREAD_SAFE, 64-bit ticks) are
+ * expected to grow the slot.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+#if !defined(HESTIA_TEMPO_TIMEBASE_US) && !defined(HESTIA_TEMPO_THREAD_SAFE) && \
+    !defined(HESTIA_TEMPO_STATS) && !defined(HESTIA_TEMPO_BACKEND_ESP_TIMER)
+static_assert(sizeof(Slot) == 16, "default slot: timestamps, Id, flags, no padding");
+#endif
+
+void test_slot_has_no_tail_padding() {
+  // Every byte after the Id is a field: overruns, kind, flag byte
+  TEST_ASSERT_TRUE(sizeof(Slot) >= 2 * sizeof(Tick) + sizeof(Id) + 4);
+  TEST_ASSERT_EQUAL_size_t(0, sizeof(Slot) % alignof(Tick));
+}
+
+void test_flags_share_one_byte() {
+  Slot s;
+  TEST_ASSERT_FALSE(s.active);
+  TEST_ASSERT_FALSE(s.release);
+  TEST_ASSERT_FALSE(s.consumed);
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)CatchUp::Burst, s.catchUp);
+
+  s.catchUp = (uint8_t)CatchUp::Coalesce;
+  s.active  = true;
+  TEST_ASSERT_TRUE(s.active);
+  TEST_ASSERT_FALSE(s.release);
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)CatchUp::Coalesce, s.catchUp);
+}
+
+void test_cold_data_stays_out_of_the_slot() {
+  // A handler and a parsed string must not change what a query reads
+  static Pool<2> pool;
+  OneShot t = pool.oneShot("L_COLD"_id);
+  t.onDone([](Id, void*) {});
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  t.start("1.5s");
+#else
+  t.start(1500);
+#endif
+  VirtualClock::advanceMs(500);
+  TEST_ASSERT_EQUAL_UINT32(1000, t.remaining());
+  TEST_ASSERT_EQUAL_UINT32(1000, pool.nextDeadline());
+  t.release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_slot_has_no_tail_padding);
+  RUN_TEST(test_flags_share_one_byte);
+  RUN_TEST(test_cold_data_stays_out_of_the_slot);
+  return UNITY_END();
+}
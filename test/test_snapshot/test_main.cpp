@@ -0,0 +1,190 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::snapshot() and snapshotJson() tests.
+ *
+ * @details
+ * The default pool is shared with the other timers of the binary, so the
+ * visitor keeps only the Ids each test created. snapshotJson() exists only
+ * on Arduino builds.
+ */
+
+#include <unity.h>
+
+#include <string.h>
+
+#include "HestiaTempo.h"
+
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+#include <Arduino.h>
+#endif
+
+using namespace Tempo;
+
+namespace {
+
+  struct Seen {
+    TimerInfo info[8];
+    size_t    n;
+  };
+
+  Seen g_seen;
+
+  void collect(const TimerInfo& t, void*) {
+    if (g_seen.n < 8) g_seen.info[g_seen.n++] = t;
+  }
+
+  const TimerInfo* find(Id id) {
+    for (size_t i = 0; i < g_seen.n; ++i) {
+      if (g_seen.info[i].id == id) return &g_seen.info[i];
+    }
+    return nullptr;
+  }
+
+} // namespace
+
+void setUp() { g_seen = Seen{}; }
+void tearDown() {}
+
+void test_reports_each_allocated_timer() {
+  static Pool<4> pool;
+  Interval blink(pool, "S_BLINK"_id);
+  OneShot  timeout(pool, "S_TIMEOUT"_id);
+  OneShot  idle(pool, "S_IDLE"_id);
+
+  blink.every(100);
+  timeout.start(40);
+  idle.start(10);
+  idle.cancel();                 // allocated but inactive
+  VirtualClock::advanceMs(30);
+
+  TEST_ASSERT_EQUAL_size_t(3, pool.snapshot(collect, nullptr, detail::now()));
+
+  const TimerInfo* b = find("S_BLINK"_id);
+  TEST_ASSERT_NOT_NULL(b);
+  TEST_ASSERT_TRUE(b->kind == Kind::Interval);
+  TEST_ASSERT_TRUE(b->active);
+  TEST_ASSERT_EQUAL_UINT32(30, b->elapsed);
+  TEST_ASSERT_EQUAL_UINT32(70, b->remaining);
+
+  const TimerInfo* t = find("S_TIMEOUT"_id);
+  TEST_ASSERT_NOT_NULL(t);
+  TEST_ASSERT_TRUE(t->kind == Kind::OneShot);
+  TEST_ASSERT_EQUAL_UINT32(10, t->remaining);
+
+  const TimerInfo* i = find("S_IDLE"_id);
+  TEST_ASSERT_NOT_NULL(i);
+  TEST_ASSERT_FALSE(i->active);
+  TEST_ASSERT_EQUAL_UINT32(0, i->elapsed);
+  TEST_ASSERT_EQUAL_UINT32(0, i->remaining);
+
+  // Overdue: remaining saturates at 0, elapsed keeps counting
+  VirtualClock::advanceMs(20);
+  g_seen = Seen{};
+  pool.snapshot(collect, nullptr, detail::now());
+  TEST_ASSERT_EQUAL_UINT32(0, find("S_TIMEOUT"_id)->remaining);
+  TEST_ASSERT_EQUAL_UINT32(50, find("S_TIMEOUT"_id)->elapsed);
+
+  // Released slots are not visited
+  idle.release();
+  g_seen = Seen{};
+  TEST_ASSERT_EQUAL_size_t(2, pool.snapshot(collect, nullptr, detail::now()));
+  TEST_ASSERT_NULL(find("S_IDLE"_id));
+
+  blink.release();
+  timeout.release();
+}
+
+void test_reports_overruns() {
+  static Pool<1> pool;
+  Interval tick(pool, "S_TICK"_id);
+  tick.catchUp(CatchUp::Skip);
+  tick.every(100);
+
+  VirtualClock::advanceMs(350);  // three boundaries passed
+  TEST_ASSERT_TRUE(tick.every(100));
+
+  pool.snapshot(collect, nullptr, detail::now());
+  TEST_ASSERT_EQUAL_UINT32(tick.overruns(), find("S_TICK"_id)->overruns);
+  TEST_ASSERT_EQUAL_UINT32(2, find("S_TICK"_id)->overruns);
+  tick.release();
+}
+
+void test_global_snapshot_covers_all_pools() {
+  static Pool<2> pool;
+  OneShot a(pool, "S_POOLED"_id);
+  OneShot b("S_DEFAULT"_id);
+  a.start(100);
+  b.start(100);
+
+  TEST_ASSERT_TRUE(snapshot(collect) >= 2);
+  TEST_ASSERT_NOT_NULL(find("S_POOLED"_id));
+  TEST_ASSERT_NOT_NULL(find("S_DEFAULT"_id));
+
+  a.release();
+  b.release();
+}
+
+#if !defined(HESTIA_TEMPO_MINIMAL)
+void test_rate_limit_reports_wait_time() {
+  static Pool<1> pool;
+  RateLimit r(pool, "S_LIMIT"_id);
+  TEST_ASSERT_TRUE(r.allow(5, 1));   // bucket empty, next token in 200 ms
+  VirtualClock::advanceMs(50);
+
+  pool.snapshot(collect, nullptr, detail::now());
+  const TimerInfo* info = find("S_LIMIT"_id);
+  TEST_ASSERT_NOT_NULL(info);
+  TEST_ASSERT_TRUE(info->kind == Kind::RateLimit);
+  TEST_ASSERT_EQUAL_UINT32(r.nextToken(), info->remaining);
+  TEST_ASSERT_EQUAL_UINT32(150, info->remaining);
+  r.release();
+}
+#endif
+
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+namespace {
+
+  class BufferPrint : public Print {
+  public:
+    char   text[512] = {};
+    size_t len = 0;
+
+    size_t write(uint8_t c) override {
+      if (len + 1 >= sizeof(text)) return 0;
+      text[len++] = (char)c;
+      return 1;
+    }
+  };
+
+} // namespace
+
+void test_json_lists_timers() {
+  OneShot t("S_JSON"_id);
+  t.start(250);
+  VirtualClock::advanceMs(100);
+
+  BufferPrint  out;
+  const size_t written = snapshotJson(out);
+  TEST_ASSERT_EQUAL_size_t(out.len, written);
+  TEST_ASSERT_EQUAL_INT('[', out.text[0]);
+  TEST_ASSERT_EQUAL_INT(']', out.text[out.len - 1]);
+  TEST_ASSERT_NOT_NULL(strstr(out.text, "\"kind\":\"oneshot\",\"active\":true,"
+                                        "\"elapsed\":100,\"remaining\":150,"
+                                        "\"overruns\":0}"));
+  t.release();
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reports_each_allocated_timer);
+  RUN_TEST(test_reports_overruns);
+  RUN_TEST(test_global_snapshot_covers_all_pools);
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_rate_limit_reports_wait_time);
+#endif
+#if defined(ARDUINO) && !defined(HESTIA_TEMPO_MINIMAL)
+  RUN_TEST(test_json_lists_timers);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,116 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Lateness statistics tests (HESTIA_TEMPO_STATS).
+ *
+ * @details
+ * Run by `pio test -e native_instrumented`. Lateness is made exact by
+ * checking each timer a chosen number of milliseconds after its deadline.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+#if defined(HESTIA_TEMPO_STATS)
+namespace {
+
+  struct Visited {
+    Id     id;
+    Kind   kind;
+    Stats  stats;
+    size_t n;
+  };
+
+  void keep(Id id, Kind kind, const Stats& st, void* ctx) {
+    Visited& v = *static_cast<Visited*>(ctx);
+    v = Visited{ id, kind, st, v.n + 1 };
+  }
+
+} // namespace
+
+void test_interval_lateness() {
+  Interval t = interval("S_LATE"_id);
+  TEST_ASSERT_EQUAL_UINT32(0, t.stats().count);   // nothing recorded yet
+  t.every(100);
+
+  // Burst keeps the deadline grid fixed: expiry k is handled late[k] ms late
+  const Tick     t0     = VirtualClock::now();
+  const uint32_t late[] = { 0, 1, 3, 6, 0 };
+  for (uint32_t k = 0; k < 5; ++k) {
+    VirtualClock::set(t0 + (Tick)((k + 1) * 100 + late[k]) * TICKS_PER_MS);
+    TEST_ASSERT_TRUE(t.every(100));
+  }
+
+  const Stats st = t.stats();
+  TEST_ASSERT_EQUAL_UINT32(5, st.count);
+  TEST_ASSERT_EQUAL_UINT32(0, st.minLate);
+  TEST_ASSERT_EQUAL_UINT32(6 * TICKS_PER_MS, st.maxLate);
+  TEST_ASSERT_EQUAL_UINT32(2 * TICKS_PER_MS, st.meanLate());
+  TEST_ASSERT_EQUAL_UINT16(2, st.histogram[0]);   // under 1 ms
+  TEST_ASSERT_EQUAL_UINT16(1, st.histogram[1]);   // 1 ms
+  TEST_ASSERT_EQUAL_UINT16(1, st.histogram[2]);   // 2-3 ms
+  TEST_ASSERT_EQUAL_UINT16(1, st.histogram[3]);   // 4-7 ms
+  t.release();
+}
+
+void test_open_ended_last_bucket() {
+  Interval t = interval("S_STALL"_id);
+  t.catchUp(CatchUp::Skip);
+  t.every(1000);
+  VirtualClock::advanceMs(1000 + 900);
+  TEST_ASSERT_TRUE(t.every(1000));
+  TEST_ASSERT_EQUAL_UINT16(1, t.stats().histogram[Stats::BUCKETS - 1]);
+  t.release();
+}
+
+void test_poll_records_oneshot_lateness() {
+  static Pool<2> pool;
+  OneShot t = pool.oneShot("S_POLLED"_id);
+  t.onDone([](Id, void*) {});
+  t.start(50);
+  VirtualClock::advanceMs(55);
+  TEST_ASSERT_EQUAL_size_t(1, poll());
+
+  Visited v = {};
+  TEST_ASSERT_EQUAL_size_t(1, pool.visitStats(keep, &v));
+  TEST_ASSERT_EQUAL_HEX32("S_POLLED"_id, v.id);
+  TEST_ASSERT_TRUE(v.kind == Kind::OneShot);
+  TEST_ASSERT_EQUAL_UINT32(1, v.stats.count);
+  TEST_ASSERT_EQUAL_UINT32(5 * TICKS_PER_MS, v.stats.maxLate);
+
+  pool.resetStats();
+  v = Visited{};
+  pool.visitStats(keep, &v);
+  TEST_ASSERT_EQUAL_UINT32(0, v.stats.count);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, v.stats.minLate);
+  t.release();
+}
+
+void test_release_clears_stats() {
+  Interval t = interval("S_RELEASE"_id);
+  t.every(10);
+  VirtualClock::advanceMs(10);
+  t.every(10);
+  TEST_ASSERT_EQUAL_UINT32(1, t.stats().count);
+  t.release();
+  t.every(10);
+  TEST_ASSERT_EQUAL_UINT32(0, t.stats().count);
+  t.release();
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+#if defined(HESTIA_TEMPO_STATS)
+  RUN_TEST(test_interval_lateness);
+  RUN_TEST(test_open_ended_last_bucket);
+  RUN_TEST(test_poll_records_oneshot_lateness);
+  RUN_TEST(test_release_clears_stats);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,96 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Microsecond time base tests (HESTIA_TEMPO_TIMEBASE_US).
+ *
+ * @details
+ * Run by `pio test -e native_us`. Without the option only the millisecond
+ * conversions are checked.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+void setUp() {}
+void tearDown() {}
+
+void test_millisecond_api_is_unchanged() {
+  OneShot t = oneShot("U_MS"_id);
+  t.start(20);
+  VirtualClock::advanceMs(5);
+  TEST_ASSERT_EQUAL_UINT32(5, t.elapsed());
+  TEST_ASSERT_EQUAL_UINT32(15, t.remaining());
+  t.release();
+}
+
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+static_assert(sizeof(Tick) == 8, "64-bit time base");
+static_assert(TICKS_PER_MS == 1000, "microsecond ticks");
+
+void test_sub_millisecond_interval() {
+  Interval t = interval("U_EVERY"_id);
+  TEST_ASSERT_FALSE(t.every_us(250));
+
+  int fired = 0;
+  for (int us = 0; us < 10000; us += 50) {
+    VirtualClock::advance(50);
+    if (t.every_us(250)) ++fired;
+  }
+  TEST_ASSERT_EQUAL_INT(40, fired);
+  TEST_ASSERT_TRUE(t.remaining_us() == 250);
+  t.release();
+}
+
+void test_oneshot_in_microseconds() {
+  OneShot t = oneShot("U_ONESHOT"_id);
+  t.start_us(1500);
+  VirtualClock::advance(400);
+  TEST_ASSERT_TRUE(t.elapsed_us() == 400);
+  TEST_ASSERT_TRUE(t.remaining_us() == 1100);
+
+  // Millisecond queries round elapsed down and remaining up
+  TEST_ASSERT_EQUAL_UINT32(0, t.elapsed());
+  TEST_ASSERT_EQUAL_UINT32(2, t.remaining());
+  TEST_ASSERT_EQUAL_UINT32(2, nextDeadline());
+
+  VirtualClock::advance(1099);
+  TEST_ASSERT_FALSE(t.done());
+  VirtualClock::advance(1);
+  TEST_ASSERT_TRUE(t.done());
+  t.release();
+}
+
+void test_durations_beyond_32_bit_microseconds() {
+  OneShot t = oneShot("U_LONG"_id);
+  t.start(5000000);                     // 5000 s = 5e9 us
+  VirtualClock::advanceMs(4999999);
+  TEST_ASSERT_TRUE(t.remaining_us() == 1000);
+  TEST_ASSERT_EQUAL_UINT32(1, t.remaining());
+  VirtualClock::advanceMs(1);
+  TEST_ASSERT_TRUE(t.done());
+  t.release();
+}
+
+void test_handles_in_microseconds() {
+  OneShotHandle h = bind<OneShot>("U_HANDLE"_id);
+  h.start_us(10);
+  TEST_ASSERT_TRUE(h.remaining_us() == 10);
+  VirtualClock::advance(10);
+  TEST_ASSERT_TRUE(h.done());
+  h.release();
+}
+#endif
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_millisecond_api_is_unchanged);
+#if defined(HESTIA_TEMPO_TIMEBASE_US)
+  RUN_TEST(test_sub_millisecond_interval);
+  RUN_TEST(test_oneshot_in_microseconds);
+  RUN_TEST(test_durations_beyond_32_bit_microseconds);
+  RUN_TEST(test_handles_in_microseconds);
+#endif
+  return UNITY_END();
+}
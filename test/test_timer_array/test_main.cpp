@@ -0,0 +1,94 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::TimerArray tests (member Ids, independence, deadlines).
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+static OneShotArray<4>  g_relays("A_RELAY"_id);
+static IntervalArray<3> g_sensors("A_SENSOR"_id);
+
+static_assert(OneShotArray<4>::size == 4, "member count");
+
+void setUp() {}
+void tearDown() {
+  for (size_t i = 0; i < g_relays.size; ++i) g_relays[i].cancel();
+  for (size_t i = 0; i < g_sensors.size; ++i) g_sensors[i].release();
+}
+
+void test_member_ids_follow_base() {
+  for (size_t i = 0; i < g_relays.size; ++i) {
+    TEST_ASSERT_EQUAL_HEX32("A_RELAY"_id + (Id)i, g_relays[i].id());
+  }
+  TEST_ASSERT_EQUAL_HEX32("A_SENSOR"_id + 2, g_sensors[2].id());
+}
+
+void test_members_are_independent() {
+  g_relays[0].start(100);
+  g_relays[2].start(30);
+  TEST_ASSERT_TRUE(g_relays[0].running());
+  TEST_ASSERT_FALSE(g_relays[1].running());
+  TEST_ASSERT_TRUE(g_relays[2].running());
+
+  VirtualClock::advanceMs(30);
+  TEST_ASSERT_FALSE(g_relays[0].done());
+  TEST_ASSERT_TRUE(g_relays[2].done());
+
+  g_relays[0].cancel();
+  TEST_ASSERT_FALSE(g_relays[0].running());
+  TEST_ASSERT_TRUE(g_relays[2].done());
+}
+
+void test_state_persists_across_handles() {
+  g_sensors[1].every(100);
+  VirtualClock::advanceMs(100);
+  TEST_ASSERT_TRUE(g_sensors[1].every(100));   // a fresh handle, same slot
+  TEST_ASSERT_FALSE(g_sensors[0].every(100));  // first call arms member 0
+  TEST_ASSERT_EQUAL_UINT32(100, g_sensors[1].remaining());
+}
+
+void test_outside_the_pools() {
+  const size_t before = defaultPool().used();
+  g_relays[3].start(50);
+  TEST_ASSERT_EQUAL_size_t(before, defaultPool().used());
+  TEST_ASSERT_FALSE(oneShot("A_RELAY"_id + 3).running());   // same Id, other timer
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, nextDeadline());
+}
+
+void test_next_deadline_over_members() {
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, g_relays.nextDeadline());
+  g_relays[1].start(80);
+  g_relays[3].start(20);
+  TEST_ASSERT_EQUAL_UINT32(20, g_relays.nextDeadline());
+
+  VirtualClock::advanceMs(20);
+  TEST_ASSERT_EQUAL_UINT32(60, g_relays.nextDeadline());
+
+  g_sensors[0].every(40);
+  VirtualClock::advanceMs(50);   // overdue Interval
+  TEST_ASSERT_EQUAL_UINT32(0, g_sensors.nextDeadline());
+}
+
+void test_arrays_do_not_share_slots() {
+  static OneShotArray<2> a;      // default base: Ids 0 and 1
+  static OneShotArray<2> b;
+  a[0].start(10);
+  TEST_ASSERT_TRUE(a[0].running());
+  TEST_ASSERT_FALSE(b[0].running());
+  a[0].cancel();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_member_ids_follow_base);
+  RUN_TEST(test_members_are_independent);
+  RUN_TEST(test_state_persists_across_handles);
+  RUN_TEST(test_outside_the_pools);
+  RUN_TEST(test_next_deadline_over_members);
+  RUN_TEST(test_arrays_do_not_share_slots);
+  return UNITY_END();
+}
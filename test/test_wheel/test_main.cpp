@@ -0,0 +1,191 @@
+/**
+ * @file    test_main.cpp
+ * @brief   Tempo::Wheel<N> tests (placement, cascade, parking, saturation).
+ *
+ * @details
+ * Expiry times are checked exactly: the tests drive the virtual clock with
+ * nextDeadline(), the way an idle loop would, and record when each Id fires.
+ */
+
+#include <unity.h>
+
+#include "HestiaTempo.h"
+
+using namespace Tempo;
+
+namespace {
+
+  constexpr uint32_t DAY_MS = 24u * 3600u * 1000u;
+
+  struct Fired {
+    Id       id[16];
+    uint32_t at[16];
+    size_t   n;
+  };
+
+  Fired    g_fired;
+  uint32_t g_elapsed;   ///< Virtual time since the test started (ms)
+
+  void record(Id id, void*) {
+    if (g_fired.n < 16) {
+      g_fired.id[g_fired.n] = id;
+      g_fired.at[g_fired.n] = g_elapsed;
+    }
+    ++g_fired.n;
+  }
+
+  /**
+   * @brief Advance to each next deadline and poll until `count` timeouts fired.
+   */
+  template <size_t N>
+  void runUntil(Wheel<N>& w, size_t count) {
+    while (g_fired.n < count) {
+      const uint32_t dl = w.nextDeadline();
+      if (dl == NO_DEADLINE) return;
+      const uint32_t step = dl ? dl : 1;
+      VirtualClock::advanceMs(step);
+      g_elapsed += step;
+      w.poll(record);
+    }
+  }
+
+} // namespace
+
+void setUp() {
+  g_fired   = Fired{};
+  g_elapsed = 0;
+}
+
+void tearDown() {}
+
+void test_start_cancel_remaining() {
+  static Wheel<4> w;
+  TEST_ASSERT_EQUAL_UINT32(4, w.capacity());
+  TEST_ASSERT_EQUAL_UINT32(NO_DEADLINE, w.nextDeadline());
+
+  TEST_ASSERT_TRUE(w.start(1, 40));
+  TEST_ASSERT_TRUE(w.running(1));
+  TEST_ASSERT_EQUAL_UINT32(40, w.remaining(1));
+  TEST_ASSERT_EQUAL_UINT32(1, w.used());
+
+  TEST_ASSERT_TRUE(w.start(1, 90));   // restart: same entry
+  TEST_ASSERT_EQUAL_UINT32(1, w.used());
+  TEST_ASSERT_EQUAL_UINT32(90, w.remaining(1));
+
+  TEST_ASSERT_TRUE(w.cancel(1));
+  TEST_ASSERT_FALSE(w.running(1));
+  TEST_ASSERT_FALSE(w.cancel(1));
+  TEST_ASSERT_EQUAL_UINT32(0, w.remaining(1));
+  TEST_ASSERT_EQUAL_UINT32(0, w.used());
+}
+
+void test_fires_exactly_across_levels() {
+  static Wheel<8> w;
+  w.start(10, 5);          // level 0
+  w.start(11, 64);         // first level-1 bucket
+  w.start(12, 4100);       // level 2
+  w.start(13, 300000);     // level 3
+  w.start(14, 20000000);   // level 4
+
+  runUntil(w, 5);
+  TEST_ASSERT_EQUAL_UINT32(5, g_fired.n);
+  const uint32_t want[] = { 5, 64, 4100, 300000, 20000000 };
+  for (size_t i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_UINT32(10 + i, g_fired.id[i]);
+    TEST_ASSERT_EQUAL_UINT32(want[i], g_fired.at[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, w.used());   // removed before its handler ran
+}
+
+void test_polling_every_millisecond() {
+  static Wheel<4> w;
+  w.start(1, 130);
+  w.start(2, 129);
+
+  for (uint32_t t = 1; t <= 200; ++t) {
+    VirtualClock::advanceMs(1);
+    g_elapsed = t;
+    w.poll(record);
+  }
+  TEST_ASSERT_EQUAL_UINT32(2, g_fired.n);
+  TEST_ASSERT_EQUAL_UINT32(2, g_fired.id[0]);
+  TEST_ASSERT_EQUAL_UINT32(129, g_fired.at[0]);
+  TEST_ASSERT_EQUAL_UINT32(130, g_fired.at[1]);
+}
+
+void test_beyond_max_span_is_parked_and_replaced() {
+  static Wheel<4> w;
+  w.start(7, 20 * DAY_MS);   // past the top level (~12.4 days)
+  w.start(8, 13 * DAY_MS);
+  TEST_ASSERT_EQUAL_UINT32(20 * DAY_MS, w.remaining(7));
+
+  runUntil(w, 2);
+  TEST_ASSERT_EQUAL_UINT32(2, g_fired.n);
+  TEST_ASSERT_EQUAL_UINT32(8, g_fired.id[0]);
+  TEST_ASSERT_EQUAL_UINT32(13 * DAY_MS, g_fired.at[0]);
+  TEST_ASSERT_EQUAL_UINT32(7, g_fired.id[1]);
+  TEST_ASSERT_EQUAL_UINT32(20 * DAY_MS, g_fired.at[1]);
+}
+
+void test_long_timeout_saturates() {
+  static Wheel<4> w;
+  TEST_ASSERT_TRUE(w.start(1, 0xF0000000u));
+  TEST_ASSERT_EQUAL_UINT32(TimerWheel::MAX_TIMEOUT_MS, w.remaining(1));
+
+  VirtualClock::advanceMs(1);
+  w.poll(record);
+  TEST_ASSERT_EQUAL_UINT32(0, g_fired.n);   // not misread as already past
+  TEST_ASSERT_TRUE(w.running(1));
+  w.cancel(1);
+}
+
+void test_saturation_ignores_wheel_lag() {
+  static Wheel<4> w;
+  w.start(1, 60000);
+  VirtualClock::advanceMs(1000);   // wheel time now lags by 1 s (no poll)
+
+  w.start(2, 0xFFFFFFFFu);
+  TEST_ASSERT_EQUAL_UINT32(TimerWheel::MAX_TIMEOUT_MS, w.remaining(2));
+  TEST_ASSERT_EQUAL_UINT32(59000, w.remaining(1));
+
+  w.poll(record);
+  TEST_ASSERT_EQUAL_UINT32(0, g_fired.n);
+  w.cancel(1);
+  w.cancel(2);
+}
+
+void test_restart_from_handler() {
+  static Wheel<4> w;
+  static int count = 0;
+  w.start(1, 10);
+  for (int i = 0; i < 100; ++i) {
+    VirtualClock::advanceMs(1);
+    w.poll([](Id id, void*) { ++count; w.start(id, 10); });
+  }
+  TEST_ASSERT_EQUAL_INT(10, count);
+  TEST_ASSERT_TRUE(w.cancel(1));
+}
+
+void test_full_wheel_rejects_start() {
+  static Wheel<2> w;
+  TEST_ASSERT_TRUE(w.start(1, 100));
+  TEST_ASSERT_TRUE(w.start(2, 100));
+  TEST_ASSERT_FALSE(w.start(3, 100));
+#if !defined(HESTIA_TEMPO_MINIMAL)
+  TEST_ASSERT_TRUE(lastError() == Error::SlotTableFull);
+#endif
+  TEST_ASSERT_TRUE(w.start(1, 50));   // restarting a member still works
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_start_cancel_remaining);
+  RUN_TEST(test_fires_exactly_across_levels);
+  RUN_TEST(test_polling_every_millisecond);
+  RUN_TEST(test_beyond_max_span_is_parked_and_replaced);
+  RUN_TEST(test_long_timeout_saturates);
+  RUN_TEST(test_saturation_ignores_wheel_lag);
+  RUN_TEST(test_restart_from_handler);
+  RUN_TEST(test_full_wheel_rejects_start);
+  return UNITY_END();
+}